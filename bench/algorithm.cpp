@@ -0,0 +1,195 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   algorithm.cpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** Comparisons of 1 MB vectors that only differ in their last element: the
+** memcmp paths, std::vector, and the element-wise loop (the same call with
+** a predicate, which never takes the fast path).
+** Then searches and reductions over 1 MB of int and float with each level
+** of SIMD kernels the CPU has, next to <algorithm>.
+*/
+
+#include "bench.hpp"
+#include "../containers/vector.hpp"
+#include <vector>
+#include <functional>
+#include <algorithm>
+#include <numeric>
+#include <cstdlib>
+
+template<class Vector>
+void	equalities(const std::string &name, size_t rounds)
+{
+	typedef typename Vector::value_type	value_type;
+
+	const size_t	n = (1 << 20) / sizeof(value_type);
+	Vector			a(n, value_type(7));
+	Vector			b(a);
+	long			hits = 0;
+	bench::timer	t;
+
+	b[n - 1] = value_type(8);
+	for (size_t i = 0; i < rounds; i++)
+	{
+		bench::clobber();
+		hits += (a == b);
+	}
+	bench::report(name, t.elapsed(), rounds << 20); // Mop/s reads as MB/s
+	bench::keep(hits);
+}
+
+template<class T>
+void	scalar_equalities(const std::string &name, size_t rounds)
+{
+	const size_t		n = (1 << 20) / sizeof(T);
+	ft::vector<T>		a(n, T(7));
+	ft::vector<T>		b(a);
+	long				hits = 0;
+	bench::timer		t;
+
+	b[n - 1] = T(8);
+	for (size_t i = 0; i < rounds; i++)
+	{
+		bench::clobber();
+		hits += ft::equal(a.begin(), a.end(), b.begin(), std::equal_to<T>());
+	}
+	bench::report(name, t.elapsed(), rounds << 20);
+	bench::keep(hits);
+}
+
+template<class Vector>
+void	orderings(const std::string &name, size_t rounds)
+{
+	typedef typename Vector::value_type	value_type;
+
+	const size_t	n = (1 << 20) / sizeof(value_type);
+	Vector			a(n, value_type(7));
+	Vector			b(a);
+	long			hits = 0;
+	bench::timer	t;
+
+	b[n - 1] = value_type(8);
+	for (size_t i = 0; i < rounds; i++)
+	{
+		bench::clobber();
+		hits += (a < b);
+	}
+	bench::report(name, t.elapsed(), rounds << 20);
+	bench::keep(hits);
+}
+
+template<class T>
+void	scalar_orderings(const std::string &name, size_t rounds)
+{
+	const size_t		n = (1 << 20) / sizeof(T);
+	ft::vector<T>		a(n, T(7));
+	ft::vector<T>		b(a);
+	long				hits = 0;
+	bench::timer		t;
+
+	b[n - 1] = T(8);
+	for (size_t i = 0; i < rounds; i++)
+	{
+		bench::clobber();
+		hits += ft::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end(), std::less<T>());
+	}
+	bench::report(name, t.elapsed(), rounds << 20);
+	bench::keep(hits);
+}
+
+static const char	*g_isa[] = { "scalar", "sse4.1", "avx2" };
+
+// the searched value is at the very end, min and max are in the middle
+template<class T>
+void	searches(const std::string &type, size_t rounds)
+{
+	const size_t	n = (1 << 20) / sizeof(T);
+	ft::vector<T>	v(n);
+	long			sum = 0;
+
+	for (size_t i = 0; i < n; i++)
+		v[i] = T(i % 1000);
+	v[n - 1] = T(-1);
+	v[n / 2] = T(-2);
+	v[n / 3] = T(5000);
+	for (int level = ft::simd::SCALAR; level <= ft::simd::detect(); level++)
+	{
+		std::string		isa(std::string(" (") + g_isa[level] + ")");
+		bench::timer	t;
+
+		ft::simd::set_level(ft::simd::isa(level));
+		for (size_t i = 0; i < rounds; i++, bench::clobber())
+			sum += ft::find(v.begin(), v.end(), T(-1)) - v.begin();
+		bench::report("ft::find " + type + isa, t.elapsed(), rounds * n);
+		t.reset();
+		for (size_t i = 0; i < rounds; i++, bench::clobber())
+			sum += ft::count(v.begin(), v.end(), T(7));
+		bench::report("ft::count " + type + isa, t.elapsed(), rounds * n);
+		t.reset();
+		for (size_t i = 0; i < rounds; i++, bench::clobber())
+			sum += ft::min_element(v.begin(), v.end()) - v.begin();
+		bench::report("ft::min_element " + type + isa, t.elapsed(), rounds * n);
+		t.reset();
+		for (size_t i = 0; i < rounds; i++, bench::clobber())
+			sum += ft::max_element(v.begin(), v.end()) - v.begin();
+		bench::report("ft::max_element " + type + isa, t.elapsed(), rounds * n);
+		t.reset();
+		for (size_t i = 0; i < rounds; i++, bench::clobber())
+			sum += static_cast<long>(ft::accumulate(v.begin(), v.end(), T(0)));
+		bench::report("ft::accumulate " + type + isa, t.elapsed(), rounds * n);
+	}
+
+	std::vector<T>	s(v.begin(), v.end());
+	bench::timer	t;
+	for (size_t i = 0; i < rounds; i++, bench::clobber())
+		sum += std::find(s.begin(), s.end(), T(-1)) - s.begin();
+	bench::report("std::find " + type, t.elapsed(), rounds * n);
+	t.reset();
+	for (size_t i = 0; i < rounds; i++, bench::clobber())
+		sum += std::count(s.begin(), s.end(), T(7));
+	bench::report("std::count " + type, t.elapsed(), rounds * n);
+	t.reset();
+	for (size_t i = 0; i < rounds; i++, bench::clobber())
+		sum += std::min_element(s.begin(), s.end()) - s.begin();
+	bench::report("std::min_element " + type, t.elapsed(), rounds * n);
+	t.reset();
+	for (size_t i = 0; i < rounds; i++, bench::clobber())
+		sum += static_cast<long>(std::accumulate(s.begin(), s.end(), T(0)));
+	bench::report("std::accumulate " + type, t.elapsed(), rounds * n);
+	bench::keep(sum);
+}
+
+int main(int ac, char **av)
+{
+	size_t rounds = (ac > 1 ? std::atol(av[1]) : 2000);
+
+	bench::title("operator== on 1 MB (MB/s)");
+	equalities<ft::vector<unsigned char> >("ft vector<unsigned char>", rounds);
+	equalities<std::vector<unsigned char> >("std vector<unsigned char>", rounds);
+	scalar_equalities<unsigned char>("element-wise unsigned char", rounds);
+	equalities<ft::vector<int> >("ft vector<int>", rounds);
+	equalities<std::vector<int> >("std vector<int>", rounds);
+	scalar_equalities<int>("element-wise int", rounds);
+
+	bench::title("operator< on 1 MB (MB/s)");
+	orderings<ft::vector<unsigned char> >("ft vector<unsigned char>", rounds);
+	orderings<std::vector<unsigned char> >("std vector<unsigned char>", rounds);
+	scalar_orderings<unsigned char>("element-wise unsigned char", rounds);
+	orderings<ft::vector<int> >("ft vector<int>", rounds);
+	orderings<std::vector<int> >("std vector<int>", rounds);
+	scalar_orderings<int>("element-wise int", rounds);
+
+	bench::title("searches on 1 MB");
+	searches<int>("int", rounds);
+	searches<float>("float", rounds);
+	return (0);
+}
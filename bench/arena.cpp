@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena.cpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** A request handler building a few temporary containers and dropping them,
+** with the default allocator and with an arena reset after each request.
+*/
+
+#include "bench.hpp"
+#include "../containers/vector.hpp"
+#include "../containers/map.hpp"
+#include "../containers/stack.hpp"
+#include "../utils/arena.hpp"
+#include <cstdlib>
+
+template<template<class> class Allocator>
+struct request
+{
+	typedef ft::map<int, int, std::less<int>, Allocator<ft::pair<const int, int> > >	map_type;
+	typedef ft::vector<int, Allocator<int> >											vector_type;
+	typedef ft::stack<int, vector_type>												stack_type;
+
+	// returns something depending on every container
+	template<class Source>
+	static long handle(Source &source, bench::rng &rng)
+	{
+		map_type	index((std::less<int>()), source);
+		vector_type	values(source);
+		stack_type	pending((vector_type(source)));
+		size_t		n = 64 + rng.next() % 64;
+
+		for (size_t i = 0; i < n; i++)
+		{
+			int k = static_cast<int>(rng.next() % 1024);
+			index[k] += 1;
+			values.push_back(k);
+			if (k & 1)
+				pending.push(k);
+		}
+		return (index.size() + values.size() + pending.size());
+	}
+};
+
+// std::allocator ignores the arena argument
+template<class T>
+struct heap_allocator : public std::allocator<T>
+{
+	template<class U>
+	struct rebind { typedef heap_allocator<U> other; };
+
+	heap_allocator() {}
+
+	heap_allocator(ft::arena &) {}
+
+	template<class U>
+	heap_allocator(const heap_allocator<U> &) {}
+};
+
+int main(int ac, char **av)
+{
+	size_t		n = (ac > 1 ? std::atol(av[1]) : 200000);
+	ft::arena	arena;
+	long		sum = 0;
+
+	bench::title("per-request temporary map + vector + stack");
+	{
+		bench::rng		rng;
+		bench::timer	t;
+		for (size_t i = 0; i < n; i++)
+			sum += request<heap_allocator>::handle(arena, rng);
+		bench::report("std::allocator", t.elapsed(), n);
+	}
+	{
+		bench::rng		rng;
+		bench::timer	t;
+		for (size_t i = 0; i < n; i++)
+		{
+			sum += request<ft::arena_allocator>::handle(arena, rng);
+			arena.reset();
+		}
+		bench::report("arena_allocator + reset", t.elapsed(), n);
+	}
+	bench::keep(sum);
+	std::cout << "    arena holds " << arena.reserved() / 1024 << " KB" << std::endl;
+	return (0);
+}
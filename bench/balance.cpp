@@ -0,0 +1,74 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   balance.cpp                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** Red-black vs AVL behind the same ft::map interface: tree depth after
+** random and ascending loads, and insert / find / erase throughput.
+*/
+
+#include "bench.hpp"
+#include "../containers/map.hpp"
+#include <cstdlib>
+
+template<class Balance>
+void	run(const std::string &name, size_t n, bool ascending)
+{
+	typedef ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, Balance>	map_type;
+	typedef ft::RBTree<ft::pair<const int, int>, int, std::less<int>,
+		std::allocator<ft::node<ft::pair<const int, int> > >, Balance>								tree_type;
+
+	ft::vector<int>	keys;
+	bench::rng		rng;
+	for (size_t i = 0; i < n; i++)
+		keys.push_back(ascending ? static_cast<int>(i) : static_cast<int>(rng.next() % (n * 4)));
+
+	tree_type	tree;
+	for (size_t i = 0; i < n; i++)
+		tree.insert(ft::make_pair(keys[i], 0));
+
+	map_type		m;
+	bench::timer	t;
+	for (size_t i = 0; i < n; i++)
+		m.insert(ft::make_pair(keys[i], static_cast<int>(i)));
+	double insert_time = t.elapsed();
+
+	long sum = 0;
+	t.reset();
+	for (size_t round = 0; round < 4; round++)
+		for (size_t i = 0; i < n; i++)
+			sum += m.find(keys[i])->second;
+	double find_time = t.elapsed();
+	bench::keep(sum);
+
+	t.reset();
+	for (size_t i = 0; i < n; i += 2)
+		m.erase(keys[i]);
+	double erase_time = t.elapsed();
+
+	COUT_NC(name << (ascending ? " (ascending keys)" : " (random keys)")
+		<< ": size=" << tree.size() << " depth=" << tree.depth());
+	bench::report("  insert", insert_time, n);
+	bench::report("  find x4", find_time, n * 4);
+	bench::report("  erase half", erase_time, n / 2);
+}
+
+int main(int ac, char **av)
+{
+	size_t n = (ac > 1 ? std::atol(av[1]) : 200000);
+
+	bench::title("map balancing policies");
+	run<ft::rb_balance>("red-black", n, false);
+	run<ft::avl_balance>("avl", n, false);
+	run<ft::rb_balance>("red-black", n, true);
+	run<ft::avl_balance>("avl", n, true);
+	return (0);
+}
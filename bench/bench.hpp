@@ -0,0 +1,166 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+#include <time.h>
+#include <unistd.h>
+#include <cstring>
+#include <cerrno>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include "../utils/utils.hpp"
+
+/*
+** BENCHMARK HELPERS
+** Shared by every benchmark: a monotonic timer, a reproducible random
+** generator and a one line report per measurement.
+*/
+
+namespace bench
+{
+	inline double now()
+	{
+		struct timespec ts;
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+		return (ts.tv_sec + ts.tv_nsec * 1e-9);
+	}
+
+	class timer
+	{
+		public:
+			timer() : _start(now()) {}
+
+			void reset()
+			{ _start = now(); }
+
+			double elapsed() const
+			{ return (now() - _start); }
+
+		private:
+			double	_start;
+	};
+
+	// xorshift64, good enough to scatter keys and deterministic across runs
+	class rng
+	{
+		public:
+			explicit rng(unsigned long seed = 88172645463325252UL) : _state(seed) {}
+
+			unsigned long next()
+			{
+				_state ^= _state << 13;
+				_state ^= _state >> 7;
+				_state ^= _state << 17;
+				return (_state);
+			}
+
+		private:
+			unsigned long	_state;
+	};
+
+	// keeps the optimizer from dropping a computed (arithmetic) result
+	template<class T>
+	inline void keep(T value)
+	{
+		static volatile T sink;
+		sink = value;
+		(void)sink;
+	}
+
+	// makes the optimizer assume any memory may have changed, so a pure
+	// computation over unchanged buffers is not hoisted out of the loop
+	inline void clobber()
+	{ __asm__ __volatile__("" : : : "memory"); }
+
+	// one hardware event counted for this thread; perf_event_open is often
+	// refused (perf_event_paranoid, containers), then available() is false
+	class perf_counter
+	{
+		public:
+			perf_counter(unsigned type, unsigned long long config) : _fd(-1), _error(0)
+			{
+				struct perf_event_attr attr;
+				std::memset(&attr, 0, sizeof(attr));
+				attr.size = sizeof(attr);
+				attr.type = type;
+				attr.config = config;
+				attr.disabled = 1;
+				attr.exclude_kernel = 1;
+				attr.exclude_hv = 1;
+				_fd = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+				if (_fd < 0)
+					_error = errno;
+			}
+
+			~perf_counter()
+			{
+				if (_fd >= 0)
+					close(_fd);
+			}
+
+			bool available() const
+			{ return (_fd >= 0); }
+
+			// why perf_event_open failed
+			const char *error() const
+			{ return (std::strerror(_error)); }
+
+			void start()
+			{
+				if (_fd < 0)
+					return ;
+				ioctl(_fd, PERF_EVENT_IOC_RESET, 0);
+				ioctl(_fd, PERF_EVENT_IOC_ENABLE, 0);
+			}
+
+			unsigned long long stop()
+			{
+				unsigned long long count = 0;
+				if (_fd < 0)
+					return (0);
+				ioctl(_fd, PERF_EVENT_IOC_DISABLE, 0);
+				if (read(_fd, &count, sizeof(count)) != sizeof(count))
+					return (0);
+				return (count);
+			}
+
+		private:
+			perf_counter(const perf_counter &);
+			perf_counter &operator=(const perf_counter &);
+
+			int	_fd;
+			int	_error;
+	};
+
+	inline unsigned long long dtlb_read_misses()
+	{
+		return (PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+			| (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+	}
+
+	inline void title(const std::string &name)
+	{ COUT(B_CYAN, std::endl << "---- " << name << " ----"); }
+
+	inline void report(const std::string &name, double seconds, size_t ops)
+	{
+		std::cout << std::left << std::setw(40) << name
+			<< std::right << std::setw(10) << std::fixed << std::setprecision(2)
+			<< seconds * 1000.0 << " ms"
+			<< std::setw(10) << std::setprecision(2)
+			<< (seconds > 0 ? ops / seconds / 1e6 : 0.0) << " Mop/s" << std::endl;
+	}
+}
@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bloom.cpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** Lookups where 80% of the keys are missing, with and without a blocked
+** Bloom filter in front of the tree.
+*/
+
+#include "bench.hpp"
+#include "../containers/map.hpp"
+#include <cstdlib>
+
+template<class Map>
+double	probe(Map &m, size_t n, size_t queries)
+{
+	bench::rng		rng(42);
+	long			hits = 0;
+	bench::timer	t;
+
+	for (size_t i = 0; i < queries; i++)
+	{
+		unsigned long r = rng.next();
+		int key = static_cast<int>(r % n) * 2 + (r % 5 != 0); // odd keys are never stored
+		hits += (m.find(key) != m.end());
+	}
+	bench::keep(hits);
+	return (t.elapsed());
+}
+
+int main(int ac, char **av)
+{
+	typedef ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >,
+		ft::rb_balance, ft::bloom_filter<int> >		filtered_map;
+
+	size_t				n = (ac > 1 ? std::atol(av[1]) : 1000000);
+	size_t				queries = n * 2;
+	ft::map<int, int>	plain;
+	filtered_map		filtered;
+	bench::rng			rng;
+
+	for (size_t i = 0; i < n; i++)
+	{
+		int key = static_cast<int>(rng.next() % n) * 2;
+		plain.insert(ft::make_pair(key, key));
+		filtered.insert(ft::make_pair(key, key));
+	}
+
+	bench::title("find with 80% misses");
+	bench::report("map", probe(plain, n, queries), queries);
+	bench::report("map + bloom_filter<int>", probe(filtered, n, queries), queries);
+	COUT_NC("  filter: " << filtered.filter().memory() / 1024 << " KiB, "
+		<< filtered.filter().negatives() << " rejected, false positive rate "
+		<< filtered.filter().false_positive_rate() * 100 << "%");
+
+	for (size_t i = 0; i < n; i += 2)
+		filtered.erase(static_cast<int>(i));
+	filtered.rebuild_filter();
+	COUT_NC("  rebuilt after erasing, " << filtered.filter().memory() / 1024 << " KiB");
+	return (0);
+}
@@ -0,0 +1,60 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   buffered_map.cpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** Bursty ingest of random keys: ft::map::insert vs ft::buffered_map, then
+** the same lookups on both.
+*/
+
+#include "bench.hpp"
+#include "../containers/buffered_map.hpp"
+#include <cstdlib>
+
+template<class Map>
+void	lookups(const std::string &name, const Map &m, size_t n)
+{
+	bench::rng		rng;
+	long			sum = 0;
+	bench::timer	t;
+
+	for (size_t i = 0; i < n; i++)
+		sum += (m.find(static_cast<int>(rng.next() % (n * 4))) != m.end());
+	bench::report(name, t.elapsed(), n);
+	bench::keep(sum);
+}
+
+int main(int ac, char **av)
+{
+	size_t		n = (ac > 1 ? std::atol(av[1]) : 1000000);
+
+	bench::title("random key ingest");
+	{
+		ft::map<int, int>	m;
+		bench::rng			rng;
+		bench::timer		t;
+		for (size_t i = 0; i < n; i++)
+			m.insert(ft::make_pair(static_cast<int>(rng.next() % (n * 4)), static_cast<int>(i)));
+		bench::report("map::insert", t.elapsed(), n);
+		lookups("map::find", m, n);
+	}
+	{
+		ft::buffered_map<int, int>	m;
+		bench::rng					rng;
+		bench::timer				t;
+		for (size_t i = 0; i < n; i++)
+			m.insert(ft::make_pair(static_cast<int>(rng.next() % (n * 4)), static_cast<int>(i)));
+		m.flush();
+		bench::report("buffered_map::insert + flush", t.elapsed(), n);
+		lookups("buffered_map::find", m, n);
+	}
+	return (0);
+}
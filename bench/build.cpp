@@ -0,0 +1,76 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   build.cpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** Loading a map from N unsorted entries (5M by default, the first argument
+** otherwise), some keys repeated: one insert per entry, then build_parallel
+** on pools of 0, 1, 2, 4... threads up to the hardware's concurrency.
+*/
+
+#include "bench.hpp"
+#include "../containers/vector.hpp"
+#include "../containers/map.hpp"
+#include <map>
+#include <cstdlib>
+
+#if __cplusplus >= 201103L
+
+typedef ft::map<long, long>	map_type;
+
+int main(int ac, char **av)
+{
+	size_t							n = (ac > 1 ? std::atol(av[1]) : 5000000);
+	bench::rng						rng;
+	ft::vector<ft::pair<long, long> >		input;
+
+	for (size_t i = 0; i < n; i++)
+		input.push_back(ft::make_pair(static_cast<long>(rng.next() % (n * 4)), static_cast<long>(i)));
+
+	bench::title("loading " + std::to_string(n) + " unsorted entries (Mop/s)");
+	map_type reference;
+	{
+		bench::timer t;
+		reference.insert(input.begin(), input.end());
+		bench::report("ft::map insert", t.elapsed(), n);
+	}
+	{
+		std::map<long, long>	m;
+		bench::timer			t;
+		for (size_t i = 0; i < n; i++)
+			m.insert(std::make_pair(input[i].first, input[i].second));
+		bench::report("std::map insert", t.elapsed(), n);
+	}
+	{
+		// the first build faults the node memory in, the timed ones reuse it
+		map_type warmup;
+		warmup.build_parallel(input.begin(), input.end());
+	}
+	for (size_t threads = 0; threads <= ft::thread_pool::hardware_threads(); threads = (threads ? threads * 2 : 1))
+	{
+		ft::thread_pool	pool(threads);
+		map_type		m;
+		bench::timer	t;
+
+		m.build_parallel(input.begin(), input.end(), pool);
+		bench::report("build_parallel (" + std::to_string(threads) + " threads)", t.elapsed(), n);
+		if (!(m == reference))
+			CERR(B_RED, "build_parallel differs from inserting one by one");
+	}
+	return (0);
+}
+#else
+int main()
+{
+	COUT(B_CYAN, "build_parallel needs C++11 (make bench STD=c++11)");
+	return (0);
+}
+#endif
@@ -0,0 +1,208 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_queue.cpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** Throughput: N longs (4M by default, the first argument otherwise) passed
+** from producers to consumers through ft::deque behind a mutex, spsc_queue
+** one by one and in batches of 64, and mpmc_queue with 1 and 4 threads on
+** each side. Latency: N / 16 round trips between two threads, a ping in one
+** queue answered in another. Waiting threads yield, so the figures stay
+** meaningful on fewer cores than threads.
+*/
+
+#include "bench.hpp"
+#include "../containers/deque.hpp"
+#include <cstdlib>
+
+#if __cplusplus >= 201103L
+# include <mutex>
+# include <thread>
+# include <vector>
+# include "../containers/concurrent_queue.hpp"
+
+static const size_t	ring = 1024;
+static const size_t	batch = 64;
+
+// ft::deque behind a mutex, as the pipelines did it
+class locked_queue
+{
+	public:
+		bool try_push(long val)
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			if (_queue.size() == ring)
+				return (false);
+			_queue.push_back(val);
+			return (true);
+		}
+
+		bool try_pop(long &out)
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			if (_queue.empty())
+				return (false);
+			out = _queue.front();
+			_queue.pop_front();
+			return (true);
+		}
+
+	private:
+		ft::deque<long>	_queue;
+		std::mutex		_mutex;
+};
+
+template<class Queue>
+void	push(Queue &q, long val)
+{
+	while (!q.try_push(val))
+		std::this_thread::yield();
+}
+
+template<class Queue>
+long	pop(Queue &q)
+{
+	long val;
+	while (!q.try_pop(val))
+		std::this_thread::yield();
+	return (val);
+}
+
+// n values from each of the threads producers to as many consumers
+template<class Queue>
+void	throughput(const std::string &name, Queue &q, size_t threads, size_t n)
+{
+	std::vector<std::thread>	workers;
+	size_t						per_thread = n / threads;
+	bench::timer				t;
+
+	for (size_t i = 0; i < threads; i++)
+	{
+		workers.push_back(std::thread([&q, per_thread] {
+			for (size_t j = 0; j < per_thread; j++)
+				push(q, static_cast<long>(j));
+		}));
+		workers.push_back(std::thread([&q, per_thread] {
+			long sum = 0;
+			for (size_t j = 0; j < per_thread; j++)
+				sum += pop(q);
+			bench::keep(sum);
+		}));
+	}
+	for (size_t i = 0; i < workers.size(); i++)
+		workers[i].join();
+	bench::report(name, t.elapsed(), per_thread * threads);
+}
+
+void	batched_throughput(const std::string &name, size_t n)
+{
+	ft::spsc_queue<long, ring>	q;
+	bench::timer				t;
+
+	n -= n % batch;
+	std::thread producer([&q, n] {
+		long	buf[batch];
+		for (size_t i = 0; i < n; i += batch)
+		{
+			for (size_t j = 0; j < batch; j++)
+				buf[j] = static_cast<long>(i + j);
+			size_t done = 0;
+			while ((done += q.push_n(buf + done, batch - done)) < batch)
+				std::this_thread::yield();
+		}
+	});
+	long	buf[batch];
+	long	sum = 0;
+	for (size_t i = 0; i < n; )
+	{
+		size_t got = q.pop_n(buf, batch);
+		if (got == 0)
+			std::this_thread::yield();
+		for (size_t j = 0; j < got; j++)
+			sum += buf[j];
+		i += got;
+	}
+	producer.join();
+	bench::keep(sum);
+	bench::report(name, t.elapsed(), n);
+}
+
+// a ping through there answered through back, n times
+template<class Queue>
+void	latency(const std::string &name, Queue &there, Queue &back, size_t n)
+{
+	std::thread echo([&there, &back, n] {
+		for (size_t i = 0; i < n; i++)
+			push(back, pop(there));
+	});
+	long			sum = 0;
+	bench::timer	t;
+	for (size_t i = 0; i < n; i++)
+	{
+		push(there, static_cast<long>(i));
+		sum += pop(back);
+	}
+	double elapsed = t.elapsed();
+	echo.join();
+	bench::keep(sum);
+	std::cout << std::left << std::setw(40) << name << std::right << std::setw(10)
+		<< std::fixed << std::setprecision(0) << elapsed / n * 1e9 << " ns per round trip" << std::endl;
+}
+
+int main(int ac, char **av)
+{
+	size_t n = (ac > 1 ? std::atol(av[1]) : 4000000);
+
+	bench::title(std::to_string(n) + " longs, producers to consumers (Mop/s)");
+	{
+		locked_queue q;
+		throughput("ft::deque + mutex (1 + 1 threads)", q, 1, n);
+	}
+	{
+		ft::spsc_queue<long, ring> q;
+		throughput("spsc_queue (1 + 1 threads)", q, 1, n);
+	}
+	batched_throughput("spsc_queue push_n / pop_n of 64", n);
+	{
+		ft::mpmc_queue<long> q(ring);
+		throughput("mpmc_queue (1 + 1 threads)", q, 1, n);
+	}
+	{
+		locked_queue q;
+		throughput("ft::deque + mutex (4 + 4 threads)", q, 4, n);
+	}
+	{
+		ft::mpmc_queue<long> q(ring);
+		throughput("mpmc_queue (4 + 4 threads)", q, 4, n);
+	}
+
+	bench::title(std::to_string(n / 16) + " round trips between two threads");
+	{
+		locked_queue there, back;
+		latency("ft::deque + mutex", there, back, n / 16);
+	}
+	{
+		ft::spsc_queue<long, ring> there, back;
+		latency("spsc_queue", there, back, n / 16);
+	}
+	{
+		ft::mpmc_queue<long> there(ring), back(ring);
+		latency("mpmc_queue", there, back, n / 16);
+	}
+	return (0);
+}
+#else
+int main()
+{
+	COUT(B_CYAN, "concurrent_queue needs C++11 (make bench STD=c++11)");
+	return (0);
+}
+#endif
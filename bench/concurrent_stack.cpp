@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_stack.cpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** A shared free list: N push / pop pairs (4M by default, the first argument
+** otherwise) split between 1 to 32 threads, on ft::stack behind a mutex,
+** concurrent_stack and a bounded_concurrent_stack of 1024 elements.
+*/
+
+#include "bench.hpp"
+#include "../containers/stack.hpp"
+#include <cstdlib>
+
+#if __cplusplus >= 201103L
+# include <mutex>
+# include <thread>
+# include <vector>
+# include "../containers/concurrent_stack.hpp"
+
+template<class Worker>
+double	run(size_t threads, Worker work)
+{
+	std::vector<std::thread>	workers;
+	bench::timer				t;
+
+	for (size_t i = 0; i < threads; i++)
+		workers.push_back(std::thread(work, i));
+	for (size_t i = 0; i < threads; i++)
+		workers[i].join();
+	return (t.elapsed());
+}
+
+int main(int ac, char **av)
+{
+	size_t n = (ac > 1 ? std::atol(av[1]) : 4000000);
+
+	bench::title(std::to_string(n) + " push / pop pairs (Mop/s)");
+	for (size_t threads = 1; threads <= 32; threads *= 2)
+	{
+		size_t		per_thread = n / threads;
+		std::string	suffix = " (" + std::to_string(threads) + " threads)";
+		{
+			ft::stack<long>	s;
+			std::mutex		mutex;
+			double t = run(threads, [&](size_t id) {
+				long sum = 0;
+				for (size_t i = 0; i < per_thread; i++)
+				{
+					{
+						std::lock_guard<std::mutex> lock(mutex);
+						s.push(static_cast<long>(id + i));
+					}
+					std::lock_guard<std::mutex> lock(mutex);
+					if (!s.empty())
+					{
+						sum += s.top();
+						s.pop();
+					}
+				}
+				bench::keep(sum);
+			});
+			bench::report("ft::stack + mutex" + suffix, t, per_thread * threads * 2);
+		}
+		{
+			ft::concurrent_stack<long>	s;
+			double t = run(threads, [&](size_t id) {
+				long sum = 0;
+				long val;
+				for (size_t i = 0; i < per_thread; i++)
+				{
+					s.push(static_cast<long>(id + i));
+					if (s.try_pop(val))
+						sum += val;
+				}
+				bench::keep(sum);
+			});
+			bench::report("concurrent_stack" + suffix, t, per_thread * threads * 2);
+		}
+		{
+			ft::bounded_concurrent_stack<long>	s(1024);
+			double t = run(threads, [&](size_t id) {
+				long sum = 0;
+				long val;
+				for (size_t i = 0; i < per_thread; i++)
+				{
+					s.push(static_cast<long>(id + i));
+					if (s.try_pop(val))
+						sum += val;
+				}
+				bench::keep(sum);
+			});
+			bench::report("bounded_concurrent_stack" + suffix, t, per_thread * threads * 2);
+		}
+	}
+	return (0);
+}
+#else
+int main()
+{
+	COUT(B_CYAN, "concurrent_stack needs C++11 (make bench STD=c++11)");
+	return (0);
+}
+#endif
@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_vector.cpp                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** N appends (8M by default, the first argument otherwise) split between 1
+** to 32 producer threads: ft::vector behind a mutex, concurrent_vector's
+** push_back, and grow_by in batches of 64.
+*/
+
+#include "bench.hpp"
+#include "../containers/vector.hpp"
+#include <cstdlib>
+
+#if __cplusplus >= 201103L
+# include <mutex>
+# include <thread>
+# include <vector>
+# include "../containers/concurrent_vector.hpp"
+
+template<class Producer>
+double	run(size_t threads, Producer produce)
+{
+	std::vector<std::thread>	workers;
+	bench::timer				t;
+
+	for (size_t i = 0; i < threads; i++)
+		workers.push_back(std::thread(produce, i));
+	for (size_t i = 0; i < threads; i++)
+		workers[i].join();
+	return (t.elapsed());
+}
+
+int main(int ac, char **av)
+{
+	size_t n = (ac > 1 ? std::atol(av[1]) : 8000000);
+
+	bench::title("appending " + std::to_string(n) + " longs (Mop/s)");
+	for (size_t threads = 1; threads <= 32; threads *= 2)
+	{
+		size_t		per_thread = n / threads;
+		std::string	suffix = " (" + std::to_string(threads) + " threads)";
+		{
+			ft::vector<long>	v;
+			std::mutex			mutex;
+			double t = run(threads, [&](size_t id) {
+				for (size_t i = 0; i < per_thread; i++)
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					v.push_back(static_cast<long>(id + i));
+				}
+			});
+			bench::report("ft::vector + mutex" + suffix, t, per_thread * threads);
+		}
+		{
+			ft::concurrent_vector<long>	v;
+			double t = run(threads, [&](size_t id) {
+				for (size_t i = 0; i < per_thread; i++)
+					v.push_back(static_cast<long>(id + i));
+			});
+			bench::report("concurrent_vector push_back" + suffix, t, per_thread * threads);
+			if (v.size() != per_thread * threads)
+				CERR(B_RED, "concurrent_vector lost elements");
+		}
+		{
+			ft::concurrent_vector<long>	v;
+			double t = run(threads, [&](size_t id) {
+				long batch[64];
+				for (size_t i = 0; i + 64 <= per_thread; i += 64)
+				{
+					for (size_t j = 0; j < 64; j++)
+						batch[j] = static_cast<long>(id + i + j);
+					v.grow_by(batch, batch + 64);
+				}
+			});
+			bench::report("concurrent_vector grow_by(64)" + suffix, t, per_thread / 64 * 64 * threads);
+		}
+	}
+	return (0);
+}
+#else
+int main()
+{
+	COUT(B_CYAN, "concurrent_vector needs C++11 (make bench STD=c++11)");
+	return (0);
+}
+#endif
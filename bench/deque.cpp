@@ -0,0 +1,92 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   deque.cpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** A deep stack of N ints (16M by default, the first argument otherwise),
+** timed per batch of 1024 pushes: the slowest batch is the cost of the
+** worst growth. Then a queue going through N ints, 1000 in flight (a
+** multiple of 4KB between the reads and the writes would time the cache's
+** address aliasing instead).
+*/
+
+#include "bench.hpp"
+#include "../containers/vector.hpp"
+#include "../containers/deque.hpp"
+#include "../containers/stack.hpp"
+#include <deque>
+#include <stack>
+#include <cstdlib>
+
+static const size_t	batch = 1024;
+static const size_t	in_flight = 1000;
+
+template<class Stack>
+void	deep_stack(const std::string &name, size_t n)
+{
+	Stack	s;
+	double	worst = 0;
+	long	sum = 0;
+
+	bench::timer	total;
+	for (size_t i = 0; i < n; i += batch)
+	{
+		bench::timer t;
+		for (size_t j = 0; j < batch; j++)
+			s.push(static_cast<int>(i + j));
+		double elapsed = t.elapsed();
+		if (elapsed > worst)
+			worst = elapsed;
+	}
+	while (!s.empty())
+	{
+		sum += s.top();
+		s.pop();
+	}
+	bench::report(name, total.elapsed(), n * 2);
+	bench::keep(sum);
+	std::cout << "    slowest 1024 pushes: " << std::fixed << std::setprecision(1)
+		<< worst * 1e6 << " us" << std::endl;
+}
+
+template<class Deque>
+void	queue(const std::string &name, size_t n)
+{
+	Deque	q;
+	long	sum = 0;
+
+	bench::timer	t;
+	for (size_t i = 0; i < in_flight; i++)
+		q.push_back(static_cast<int>(i));
+	for (size_t i = in_flight; i < n; i++)
+	{
+		sum += q.front();
+		q.pop_front();
+		q.push_back(static_cast<int>(i));
+	}
+	bench::report(name, t.elapsed(), n * 2);
+	bench::keep(sum);
+}
+
+int main(int ac, char **av)
+{
+	size_t n = (ac > 1 ? std::atol(av[1]) : 16000000);
+
+	bench::title("deep stack of ints, push then pop");
+	deep_stack<ft::stack<int, ft::vector<int> > >("ft::stack over ft::vector", n);
+	deep_stack<ft::stack<int, ft::deque<int> > >("ft::stack over ft::deque", n);
+	deep_stack<std::stack<int, std::deque<int> > >("std::stack over std::deque", n);
+
+	bench::title("queue of ints, push_back / pop_front");
+	queue<ft::deque<int> >("ft::deque", n);
+	queue<std::deque<int> >("std::deque", n);
+	return (0);
+}
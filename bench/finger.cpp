@@ -0,0 +1,50 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   finger.cpp                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** Sequential probing of a map (merge-join style): lower_bound from the root
+** for every key vs finger search from the previous result.
+*/
+
+#include "bench.hpp"
+#include "../containers/map.hpp"
+#include <cstdlib>
+
+int main(int ac, char **av)
+{
+	size_t				n = (ac > 1 ? std::atol(av[1]) : 1000000);
+	ft::map<int, int>	m;
+
+	for (size_t i = 0; i < n; i++)
+		m.insert(ft::make_pair(static_cast<int>(i * 2), static_cast<int>(i)));
+
+	bench::title("sequential lower_bound");
+
+	long			sum = 0;
+	bench::timer	t;
+	for (size_t i = 0; i < n; i++)
+		sum += m.lower_bound(static_cast<int>(i * 2 + 1))->first;
+	bench::report("from the root", t.elapsed(), n);
+	bench::keep(sum);
+
+	ft::map<int, int>::iterator	it = m.begin();
+	sum = 0;
+	t.reset();
+	for (size_t i = 0; i < n; i++)
+	{
+		it = m.lower_bound(it, static_cast<int>(i * 2 + 1));
+		sum += it->first;
+	}
+	bench::report("finger from previous result", t.elapsed(), n);
+	bench::keep(sum);
+	return (0);
+}
@@ -0,0 +1,77 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hugepage.cpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** Random reads over a large vector<long>, where nearly every access needs a
+** new TLB entry, on 4 KB pages and on transparent huge pages.
+*/
+
+#include "bench.hpp"
+#include "../containers/vector.hpp"
+#include "../utils/hugepage_allocator.hpp"
+#include <cstdio>
+#include <cstdlib>
+
+// transparent huge pages currently backing this process, in MB
+static long	anon_huge_mb()
+{
+	char	line[256];
+	long	kb = 0;
+	FILE	*f = std::fopen("/proc/self/smaps_rollup", "r");
+
+	if (f == NULL)
+		return (-1);
+	while (std::fgets(line, sizeof(line), f) != NULL)
+		if (std::sscanf(line, "AnonHugePages: %ld kB", &kb) == 1)
+			break ;
+	std::fclose(f);
+	return (kb / 1024);
+}
+
+template<class Vector>
+void	random_reads(const std::string &name, size_t n, size_t reads)
+{
+	Vector				v(n, 1);
+	bench::rng			rng;
+	bench::perf_counter	misses(PERF_TYPE_HW_CACHE, bench::dtlb_read_misses());
+	long				sum = 0;
+
+	for (size_t i = 0; i < n; i++)
+		v[i] = static_cast<long>(i);
+	bench::timer	t;
+	misses.start();
+	for (size_t i = 0; i < reads; i++)
+		sum += v[rng.next() % n];
+	unsigned long long count = misses.stop();
+	bench::report(name, t.elapsed(), reads);
+	bench::keep(sum);
+	std::cout << "    huge pages in use: " << anon_huge_mb() << " MB";
+	if (misses.available())
+		std::cout << ", dTLB read misses: " << count
+			<< " (" << static_cast<double>(count) / reads << " per read)";
+	else
+		std::cout << ", dTLB misses: unavailable (perf_event_open: " << misses.error() << ")";
+	std::cout << std::endl;
+}
+
+int main(int ac, char **av)
+{
+	size_t n = (ac > 1 ? std::atol(av[1]) : (1UL << 30) / sizeof(long));
+	size_t reads = 20000000;
+
+	bench::title("random reads over a large vector<long>");
+	if (!ft::hugepages_available())
+		std::cout << "transparent huge pages are disabled, both runs use 4 KB pages" << std::endl;
+	random_reads<ft::vector<long> >("std::allocator", n, reads);
+	random_reads<ft::vector<long, ft::hugepage_allocator<long> > >("hugepage_allocator", n, reads);
+	return (0);
+}
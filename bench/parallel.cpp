@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parallel.cpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** for_each, transform and reduce over a vector of N doubles (10M by default,
+** the first argument otherwise) and a map of N / 10 entries: the plain loop,
+** then the parallel algorithms on pools of 1, 2, 4... threads up to the
+** hardware's concurrency.
+*/
+
+#include "bench.hpp"
+#include "../containers/vector.hpp"
+#include "../containers/map.hpp"
+#include <cmath>
+#include <cstdlib>
+
+#if __cplusplus >= 201103L
+# include "../utils/parallel.hpp"
+
+// a few flops per element, so the loops are not only memory bound
+inline double	work(double x)
+{ return (std::sqrt(x * x + 1.0) * 0.5); }
+
+void	vectors(size_t n)
+{
+	ft::vector<double>	v(n);
+	ft::vector<double>	out(n);
+	double				sum = 0;
+
+	for (size_t i = 0; i < n; i++)
+		v[i] = static_cast<double>(i % 1000);
+	{
+		bench::timer t;
+		for (size_t i = 0; i < n; i++)
+			v[i] = work(v[i]);
+		bench::report("loop for_each", t.elapsed(), n);
+		t.reset();
+		for (size_t i = 0; i < n; i++)
+			out[i] = work(v[i]);
+		bench::report("loop transform", t.elapsed(), n);
+		t.reset();
+		for (size_t i = 0; i < n; i++)
+			sum += work(v[i]);
+		bench::report("loop transform_reduce", t.elapsed(), n);
+	}
+	for (size_t threads = 1; threads <= ft::thread_pool::hardware_threads(); threads *= 2)
+	{
+		ft::thread_pool		pool(threads);
+		std::string			suffix = " (" + std::to_string(threads) + " threads)";
+		bench::timer		t;
+
+		ft::parallel_for_each(v.begin(), v.end(), [](double &x) { x = work(x); }, pool);
+		bench::report("parallel_for_each" + suffix, t.elapsed(), n);
+		t.reset();
+		ft::parallel_transform(v.begin(), v.end(), out.begin(), work, pool);
+		bench::report("parallel_transform" + suffix, t.elapsed(), n);
+		t.reset();
+		sum += ft::parallel_transform_reduce(v.begin(), v.end(), 0.0, std::plus<double>(), work, pool);
+		bench::report("parallel_transform_reduce" + suffix, t.elapsed(), n);
+	}
+	bench::keep(sum + out[n / 2]);
+}
+
+void	maps(size_t n)
+{
+	typedef ft::map<int, double>	map_type;
+
+	map_type			m;
+	ft::vector<double>	out(n);
+	double				sum = 0;
+
+	for (size_t i = 0; i < n; i++)
+		m[static_cast<int>(i)] = static_cast<double>(i % 1000);
+	{
+		bench::timer t;
+		for (map_type::iterator it = m.begin(); it != m.end(); ++it)
+			it->second = work(it->second);
+		bench::report("loop for_each", t.elapsed(), n);
+		t.reset();
+		for (map_type::iterator it = m.begin(); it != m.end(); ++it)
+			sum += work(it->second);
+		bench::report("loop transform_reduce", t.elapsed(), n);
+	}
+	for (size_t threads = 1; threads <= ft::thread_pool::hardware_threads(); threads *= 2)
+	{
+		ft::thread_pool		pool(threads);
+		std::string			suffix = " (" + std::to_string(threads) + " threads)";
+		bench::timer		t;
+
+		ft::parallel_for_each(m, [](map_type::value_type &p) { p.second = work(p.second); }, pool);
+		bench::report("parallel_for_each" + suffix, t.elapsed(), n);
+		t.reset();
+		ft::parallel_transform(m, out.begin(),
+			[](const map_type::value_type &p) { return (work(p.second)); }, pool);
+		bench::report("parallel_transform" + suffix, t.elapsed(), n);
+		t.reset();
+		sum += ft::parallel_transform_reduce(m, 0.0, std::plus<double>(),
+			[](const map_type::value_type &p) { return (work(p.second)); }, pool);
+		bench::report("parallel_transform_reduce" + suffix, t.elapsed(), n);
+	}
+	bench::keep(sum + out[n / 2]);
+}
+
+int main(int ac, char **av)
+{
+	size_t n = (ac > 1 ? std::atol(av[1]) : 10000000);
+
+	bench::title("vector<double>, " + std::to_string(n) + " elements (Mop/s)");
+	vectors(n);
+	bench::title("map<int, double>, " + std::to_string(n / 10) + " elements (Mop/s)");
+	maps(n / 10);
+	return (0);
+}
+#else
+int main()
+{
+	COUT(B_CYAN, "the parallel algorithms need C++11 (make bench STD=c++11)");
+	return (0);
+}
+#endif
@@ -0,0 +1,77 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   remap.cpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** Growing and shrinking a large vector<long> with std::allocator (copy on
+** growth) and ft::mmap_allocator (mremap on growth).
+*/
+
+#include "bench.hpp"
+#include "../containers/vector.hpp"
+#include "../utils/mmap_allocator.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <unistd.h>
+
+// resident set of this process, in MB
+static long	rss_mb()
+{
+	long	pages = 0;
+	long	resident = 0;
+	FILE	*f = std::fopen("/proc/self/statm", "r");
+
+	if (f == NULL)
+		return (-1);
+	if (std::fscanf(f, "%ld %ld", &pages, &resident) != 2)
+		resident = -1;
+	std::fclose(f);
+	return (resident * sysconf(_SC_PAGESIZE) / (1024 * 1024));
+}
+
+template<class Vector>
+void	run(const std::string &name, size_t n)
+{
+	{
+		bench::timer	t;
+		Vector			v;
+		for (size_t i = 0; i < n; i++)
+			v.push_back(static_cast<long>(i));
+		bench::report(name + " push_back", t.elapsed(), n);
+		bench::keep(v[n / 2]);
+	}
+	{
+		Vector			v(n, 1);
+		bench::timer	t;
+		v.reserve(n * 2);
+		bench::report(name + " one reserve x2", t.elapsed(), n);
+		bench::keep(v[n / 2]);
+	}
+	{
+		Vector			v(n, 1);
+		long			before = rss_mb();
+		v.resize(n / 1000);
+		bench::timer	t;
+		v.shrink_to_fit();
+		bench::report(name + " shrink_to_fit", t.elapsed(), n);
+		std::cout << "    RSS " << before << " MB -> " << rss_mb() << " MB" << std::endl;
+	}
+}
+
+int main(int ac, char **av)
+{
+	size_t n = (ac > 1 ? std::atol(av[1]) : (512UL << 20) / sizeof(long));
+
+	bench::title("vector<long> growth and shrink");
+	run<ft::vector<long> >("std::allocator", n);
+	run<ft::vector<long, ft::mmap_allocator<long> > >("mmap_allocator", n);
+	return (0);
+}
@@ -0,0 +1,106 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   small_vector.cpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** Short-lived vectors of 1 to 8 elements, the per-request pattern, with an
+** allocator counting the calls that reach the heap.
+*/
+
+#include "bench.hpp"
+#include "../containers/vector.hpp"
+#include "../containers/small_vector.hpp"
+#include "../containers/stack.hpp"
+#include <vector>
+#include <cstdlib>
+
+static size_t	g_allocations = 0;
+
+template<class T>
+class counting_allocator : public std::allocator<T>
+{
+	public:
+		typedef typename std::allocator<T>::pointer		pointer;
+		typedef typename std::allocator<T>::size_type	size_type;
+
+		template<class U>
+		struct rebind { typedef counting_allocator<U> other; };
+
+		counting_allocator() {}
+
+		template<class U>
+		counting_allocator(const counting_allocator<U> &other) : std::allocator<T>(other) {}
+
+		pointer allocate(size_type n, const void *hint = 0)
+		{
+			(void)hint;
+			g_allocations++;
+			return (std::allocator<T>::allocate(n));
+		}
+};
+
+template<class Vector>
+void	short_lived(const std::string &name, size_t n)
+{
+	bench::rng		rng;
+	size_t			sum = 0;
+
+	g_allocations = 0;
+	bench::timer	t;
+	for (size_t i = 0; i < n; i++)
+	{
+		Vector	v;
+		size_t	len = 1 + rng.next() % 8;
+		for (size_t j = 0; j < len; j++)
+			v.push_back(static_cast<int>(i + j));
+		sum += v[len / 2];
+	}
+	bench::report(name, t.elapsed(), n);
+	bench::keep(sum);
+	std::cout << "    " << g_allocations << " allocations" << std::endl;
+}
+
+template<class Stack>
+void	short_stacks(const std::string &name, size_t n)
+{
+	size_t	sum = 0;
+
+	g_allocations = 0;
+	bench::timer	t;
+	for (size_t i = 0; i < n; i++)
+	{
+		Stack	s;
+		for (int j = 0; j < 6; j++)
+			s.push(j);
+		while (s.size() > 1)
+			s.pop();
+		sum += s.top();
+	}
+	bench::report(name, t.elapsed(), n);
+	bench::keep(sum);
+	std::cout << "    " << g_allocations << " allocations" << std::endl;
+}
+
+int main(int ac, char **av)
+{
+	size_t n = (ac > 1 ? std::atol(av[1]) : 5000000);
+
+	bench::title("short-lived vectors, 1 to 8 ints");
+	short_lived<ft::vector<int, counting_allocator<int> > >("ft::vector", n);
+	short_lived<std::vector<int, counting_allocator<int> > >("std::vector", n);
+	short_lived<ft::small_vector<int, 8, counting_allocator<int> > >("ft::small_vector<int, 8>", n);
+	short_lived<ft::small_vector<int, 4, counting_allocator<int> > >("ft::small_vector<int, 4>", n);
+
+	bench::title("short-lived stacks, 6 ints");
+	short_stacks<ft::stack<int, ft::vector<int, counting_allocator<int> > > >("stack over ft::vector", n);
+	short_stacks<ft::stack<int, ft::small_vector<int, 8, counting_allocator<int> > > >("stack over ft::small_vector<int, 8>", n);
+	return (0);
+}
@@ -0,0 +1,77 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   snapshot.cpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** Cold start of a large map: inserting every record vs loading a snapshot,
+** either through the linear build or by searching the mapped file in place.
+*/
+
+#include "bench.hpp"
+#include "../containers/map_snapshot.hpp"
+#include <cstdio>
+#include <cstdlib>
+
+int main(int ac, char **av)
+{
+	typedef ft::map<long, double>				map_type;
+	typedef ft::map_snapshot<long, double>		snapshot_type;
+
+	size_t			n = (ac > 1 ? std::atol(av[1]) : 1000000);
+	const char		*path = "/tmp/ft_map_snapshot.bin";
+	map_type		source;
+	bench::rng		rng;
+
+	for (size_t i = 0; i < n; i++)
+		source.insert(ft::make_pair(static_cast<long>(rng.next() >> 1), i * 0.5));
+
+	bench::title("map snapshot");
+
+	bench::timer	t;
+	ft::write_snapshot(source, path);
+	bench::report("write", t.elapsed(), source.size());
+
+	{
+		snapshot_type	snap(path, false);
+		map_type		m;
+		t.reset();
+		for (snapshot_type::const_iterator it = snap.begin(); it != snap.end(); it++)
+			m.insert(ft::make_pair(it->first, it->second));
+		bench::report("rebuild by inserting", t.elapsed(), snap.size());
+	}
+
+	t.reset();
+	{
+		snapshot_type	snap(path);
+		map_type		m;
+		snap.load(m);
+		bench::report("open + verify + build_sorted", t.elapsed(), snap.size());
+		if (m.size() != source.size() || !(m == source))
+			CERR(B_RED, "snapshot content differs from the source map");
+	}
+
+	{
+		snapshot_type	snap(path, false);
+		double			sum = 0;
+		bench::rng		probe;
+		t.reset();
+		for (size_t i = 0; i < n; i++)
+		{
+			snapshot_type::const_iterator it = snap.find(static_cast<long>(probe.next() >> 1));
+			if (it != snap.end())
+				sum += it->second;
+		}
+		bench::report("find in the mapped file", t.elapsed(), n);
+		bench::keep(sum);
+	}
+	std::remove(path);
+	return (0);
+}
@@ -0,0 +1,115 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sort.cpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** Sorting N random keys (10M by default, the first argument otherwise):
+** std::sort, ft::sort taking the radix path, ft::sort through a comparator
+** (introsort), both stable sorts, and parallel_sort on the global pool.
+*/
+
+#include "bench.hpp"
+#include "../containers/vector.hpp"
+#include "../utils/sort.hpp"
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <cstdlib>
+
+// std::less under another name: same order, no radix dispatch
+template<class T>
+struct less_than
+{
+	bool operator()(const T &a, const T &b) const
+	{ return (a < b); }
+};
+
+template<class T>
+void	check(const std::string &name, const ft::vector<T> &v)
+{
+	for (size_t i = 1; i < v.size(); i++)
+	{
+		if (v[i] < v[i - 1])
+		{
+			COUT(B_RED, name << ": not sorted at " << i);
+			std::exit(1);
+		}
+	}
+}
+
+template<class T>
+void	sorts(const std::string &type, size_t n)
+{
+	bench::rng		rng;
+	ft::vector<T>	keys(n);
+
+	for (size_t i = 0; i < n; i++)
+		keys[i] = static_cast<T>(static_cast<long>(rng.next()));
+
+	{
+		std::vector<T>	v(keys.begin(), keys.end());
+		bench::timer	t;
+		std::sort(v.begin(), v.end());
+		bench::report("std::sort " + type, t.elapsed(), n);
+	}
+	{
+		ft::vector<T>	v(keys);
+		bench::timer	t;
+		ft::sort(v.begin(), v.end());
+		bench::report("ft::sort " + type + " (radix)", t.elapsed(), n);
+		check("ft::sort", v);
+	}
+	{
+		ft::vector<T>	v(keys);
+		bench::timer	t;
+		ft::sort(v.begin(), v.end(), less_than<T>());
+		bench::report("ft::sort " + type + " (introsort)", t.elapsed(), n);
+		check("ft::sort introsort", v);
+	}
+	{
+		std::vector<T>	v(keys.begin(), keys.end());
+		bench::timer	t;
+		std::stable_sort(v.begin(), v.end());
+		bench::report("std::stable_sort " + type, t.elapsed(), n);
+	}
+	{
+		ft::vector<T>	v(keys);
+		bench::timer	t;
+		ft::stable_sort(v.begin(), v.end());
+		bench::report("ft::stable_sort " + type, t.elapsed(), n);
+		check("ft::stable_sort", v);
+	}
+#if __cplusplus >= 201103L
+	{
+		ft::vector<T>	v(keys);
+		bench::timer	t;
+		ft::parallel_sort(v.begin(), v.end(), less_than<T>());
+		bench::report("ft::parallel_sort " + type, t.elapsed(), n);
+		check("ft::parallel_sort", v);
+	}
+#endif
+}
+
+int main(int ac, char **av)
+{
+	size_t n = (ac > 1 ? std::atol(av[1]) : 10000000);
+
+#if __cplusplus >= 201103L
+	COUT(B_CYAN, "parallel_sort on " << ft::thread_pool::global().size() << " threads");
+#else
+	COUT(B_CYAN, "parallel_sort needs C++11 (make bench STD=c++11)");
+#endif
+	bench::title("sorting random keys (Mkeys/s)");
+	sorts<int>("int", n);
+	sorts<long>("long", n);
+	sorts<double>("double", n);
+	return (0);
+}
@@ -0,0 +1,76 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stable_vector.cpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** Growing a large vector one push_back at a time. Every run happens in its
+** own child process so its peak RSS can be read back with wait4.
+*/
+
+#include "bench.hpp"
+#include "../containers/vector.hpp"
+#include "../containers/stable_vector.hpp"
+#include <vector>
+#include <cstdlib>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+template<class Vector>
+void	appends(size_t n)
+{
+	Vector	v;
+	for (size_t i = 0; i < n; i++)
+		v.push_back(static_cast<long>(i));
+	bench::keep(v[n / 2]);
+}
+
+template<>
+void	appends<ft::stable_vector<long> >(size_t n)
+{
+	ft::stable_vector<long>	v(n);
+	for (size_t i = 0; i < n; i++)
+		v.push_back(static_cast<long>(i));
+	bench::keep(v[n / 2]);
+}
+
+template<class Vector>
+void	measure(const std::string &name, size_t n)
+{
+	bench::timer	t;
+	pid_t			pid = fork();
+	struct rusage	usage;
+	int				status;
+
+	if (pid == 0)
+	{
+		appends<Vector>(n);
+		std::exit(0);
+	}
+	if (pid < 0 || wait4(pid, &status, 0, &usage) < 0 || !WIFEXITED(status) || WEXITSTATUS(status))
+	{
+		CERR(N_RED, name << ": child failed");
+		return ;
+	}
+	bench::report(name, t.elapsed(), n);
+	std::cout << "    peak RSS " << usage.ru_maxrss / 1024 << " MB for "
+		<< n * sizeof(long) / (1024 * 1024) << " MB of data" << std::endl;
+}
+
+int main(int ac, char **av)
+{
+	size_t n = (ac > 1 ? std::atol(av[1]) : 50000000);
+
+	bench::title("push_back of longs into a large vector");
+	measure<ft::vector<long> >("ft::vector", n);
+	measure<std::vector<long> >("std::vector", n);
+	measure<ft::stable_vector<long> >("ft::stable_vector", n);
+	return (0);
+}
@@ -0,0 +1,186 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   vector.cpp                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** ft::vector hot paths next to std::vector.
+*/
+
+#include "bench.hpp"
+#include "../containers/vector.hpp"
+#include <vector>
+#include <list>
+#include <sstream>
+#include <iterator>
+#include <cstdlib>
+#include <cstring>
+
+template<class Vector>
+void	appends(const std::string &name, size_t n)
+{
+	bench::timer	t;
+	Vector			v;
+
+	for (size_t i = 0; i < n; i++)
+		v.push_back(static_cast<int>(i));
+	bench::report(name, t.elapsed(), n);
+	bench::keep(v.size());
+}
+
+// strings past the small string buffer: growth copies them in C++98 and
+// moves them with make STD=c++17
+template<class Vector>
+void	string_appends(const std::string &name, size_t n)
+{
+	const std::string	s(32, 'x');
+	bench::timer		t;
+	Vector				v;
+
+	for (size_t i = 0; i < n; i++)
+		v.push_back(s);
+	bench::report(name, t.elapsed(), n);
+	bench::keep(v.size());
+}
+
+template<class Vector>
+void	middle_inserts(const std::string &name, size_t n)
+{
+	Vector			v;
+	v.reserve(n);
+	bench::timer	t;
+
+	for (size_t i = 0; i < n; i++)
+		v.insert(v.begin() + v.size() / 2, static_cast<int>(i));
+	bench::report(name, t.elapsed(), n);
+	bench::keep(v.size());
+}
+
+template<class Vector>
+void	growth(const std::string &name, size_t n)
+{
+	Vector			v(n, 1);
+	bench::timer	t;
+
+	for (size_t cap = n * 2; cap <= n * 64; cap *= 2)
+		v.reserve(cap);
+	bench::report(name, t.elapsed(), n * 6); // elements relocated
+	bench::keep(v.capacity());
+}
+
+template<class Vector>
+void	middle_erases(const std::string &name, size_t n)
+{
+	Vector			v(n, 1);
+	bench::timer	t;
+
+	for (size_t i = 0; i < n / 2; i++)
+		v.erase(v.begin() + v.size() / 2);
+	bench::report(name, t.elapsed(), n / 2);
+	bench::keep(v.size());
+}
+
+// one pass over a list range, then a single pass over a stream
+template<class Vector>
+void	range_assigns(const std::string &name, size_t n)
+{
+	std::list<int>		lst;
+	std::ostringstream	out;
+	for (size_t i = 0; i < n; i++)
+	{
+		lst.push_back(static_cast<int>(i));
+		out << i << ' ';
+	}
+	Vector				v;
+	bench::timer		t;
+
+	v.assign(lst.begin(), lst.end());
+	v.insert(v.begin(), lst.begin(), lst.end());
+	std::istringstream	in(out.str());
+	v.insert(v.begin() + n / 2, std::istream_iterator<int>(in), std::istream_iterator<int>());
+	bench::report(name, t.elapsed(), n * 3);
+	bench::keep(v.size());
+}
+
+// a read buffer: grown, filled by a copy standing for read(), dropped
+template<bool Uninitialized>
+void	read_buffers(const std::string &name, size_t rounds)
+{
+	const size_t		len = 1 << 20;
+	ft::vector<char>	src(len, 'r');
+	ft::vector<char>	buf;
+	bench::timer		t;
+
+	for (size_t i = 0; i < rounds; i++)
+	{
+		if (Uninitialized)
+			buf.resize_uninitialized(len);
+		else
+			buf.resize(len);
+		std::memcpy(&buf[0], &src[0], len);
+		bench::keep(buf[i % len]);
+		buf.resize(0);
+	}
+	bench::report(name, t.elapsed(), rounds * len); // Mop/s reads as MB/s
+}
+
+// y[i] += a * x[i] through operator[], vectorizable once the access is a
+// plain load (built with FT_HARDENING 0)
+template<class Vector>
+void	indexed_axpy(const std::string &name, size_t n, size_t rounds)
+{
+	Vector			x(n, 1.5f);
+	Vector			y(n, 0.5f);
+	bench::timer	t;
+
+	for (size_t r = 0; r < rounds; r++)
+		for (size_t i = 0; i < n; i++)
+			y[i] += 0.25f * x[i];
+	bench::report(name, t.elapsed(), n * rounds);
+	bench::keep(y[n / 2]);
+}
+
+template<class Vector>
+void	shrinks(const std::string &name, size_t n)
+{
+	Vector			v(n, typename Vector::value_type(32, 's'));
+	bench::timer	t;
+
+	v.resize(n / 2);
+	v.resize(0);
+	bench::report(name, t.elapsed(), n);
+	bench::keep(v.capacity());
+}
+
+int main(int ac, char **av)
+{
+	size_t n = (ac > 1 ? std::atol(av[1]) : 10000000);
+
+	bench::title("vector<int>");
+	appends<ft::vector<int> >("ft push_back", n);
+	appends<std::vector<int> >("std push_back", n);
+	string_appends<ft::vector<std::string> >("ft push_back string", n / 10);
+	string_appends<std::vector<std::string> >("std push_back string", n / 10);
+	middle_inserts<ft::vector<int> >("ft insert in the middle", n / 200);
+	middle_inserts<std::vector<int> >("std insert in the middle", n / 200);
+	range_assigns<ft::vector<int> >("ft range assign/insert", n / 10);
+	range_assigns<std::vector<int> >("std range assign/insert", n / 10);
+	read_buffers<false>("ft resize 1MB buffer", n / 5000);
+	read_buffers<true>("ft resize_uninitialized 1MB buffer", n / 5000);
+	indexed_axpy<ft::vector<float> >("ft operator[] axpy (float)", 4096, n / 10);
+	indexed_axpy<std::vector<float> >("std operator[] axpy (float)", 4096, n / 10);
+	shrinks<ft::vector<std::string> >("ft resize shrink (string)", n / 10);
+	shrinks<std::vector<std::string> >("std resize shrink (string)", n / 10);
+	growth<ft::vector<int> >("ft reserve growth", n);
+	growth<std::vector<int> >("std reserve growth", n);
+	middle_erases<ft::vector<int> >("ft erase in the middle", n / 200);
+	middle_erases<std::vector<int> >("std erase in the middle", n / 200);
+	return (0);
+}
@@ -0,0 +1,369 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   buffered_map.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+#include "map.hpp"
+
+/*
+** BUFFERED MAP (LSM STYLE WRITE PATH)
+** Writes land in a small sorted buffer and are merged into the tree in
+** batches with map::merge_sorted, so a burst of random inserts costs one
+** ordered walk of the tree instead of a random descent and rebalance each.
+** Lookups check the buffer first, iteration merges the buffer and the tree.
+** A buffered key that turns out to already be in the tree loses, exactly as
+** a map::insert of an existing key would. insert does not look in the tree,
+** so unlike map::insert it cannot tell whether the key was new: it returns
+** nothing. operator[] and count do look.
+*/
+
+namespace ft
+{
+	template <class Key,
+			class T,
+			class Compare = std::less<Key>,
+			class Alloc = std::allocator<ft::pair<const Key, T> >,
+			size_t BufferSize = 256 >
+	class buffered_map
+	{
+		public :
+			typedef ft::map<Key, T, Compare, Alloc> map_type;
+			typedef Key key_type;
+			typedef T mapped_type;
+			typedef typename map_type::value_type value_type;
+			typedef Compare key_compare;
+			typedef Alloc allocator_type;
+			typedef size_t size_type;
+
+			/*
+			** Forward iterator over the merged content, invalidated by any write.
+			*/
+
+			class const_iterator
+			{
+				friend class buffered_map;
+				public :
+					typedef std::ptrdiff_t							difference_type;
+					typedef const typename buffered_map::value_type	value_type;
+					typedef value_type*								pointer;
+					typedef value_type&								reference;
+					typedef ft::forward_iterator_tag				iterator_category;
+
+					const_iterator() : _buf(NULL), _buf_end(NULL) {}
+
+					reference operator*() const
+					{
+						if (from_buffer())
+							return (*_buf);
+						return (*_tree);
+					}
+
+					pointer operator->() const
+					{ return (&this->operator*()); }
+
+					const_iterator& operator++()
+					{
+						if (from_buffer())
+							_buf++;
+						else
+						{
+							if (_buf != _buf_end && !_comp(_tree->first, _buf->first))
+								_buf++; // shadowed duplicate
+							_tree++;
+						}
+						return (*this);
+					}
+
+					const_iterator operator++(int)
+					{
+						const_iterator rtn(*this);
+						operator++();
+						return (rtn);
+					}
+
+					bool operator==(const const_iterator &rhs) const
+					{ return (_tree == rhs._tree && _buf == rhs._buf); }
+
+					bool operator!=(const const_iterator &rhs) const
+					{ return (!(*this == rhs)); }
+
+				private :
+					typedef typename map_type::const_iterator	tree_iterator;
+
+					const_iterator(tree_iterator tree, tree_iterator tree_end,
+							const value_type *buf, const value_type *buf_end, const key_compare &comp)
+					: _tree(tree), _tree_end(tree_end), _buf(buf), _buf_end(buf_end), _comp(comp)
+					{}
+
+					bool from_buffer() const
+					{
+						if (_buf == _buf_end)
+							return (false);
+						return (_tree == _tree_end || _comp(_buf->first, _tree->first));
+					}
+
+					tree_iterator		_tree;
+					tree_iterator		_tree_end;
+					const value_type	*_buf;
+					const value_type	*_buf_end;
+					key_compare			_comp;
+			};
+
+			explicit buffered_map(const key_compare &comp = key_compare(),
+						const allocator_type &alloc = allocator_type())
+			: _tree(comp, alloc), _comp(comp), _alloc(alloc), _buffered(0)
+			{ this->_buffer = this->_alloc.allocate(BufferSize); }
+
+			buffered_map(const buffered_map &x)
+			: _tree(x._tree), _comp(x._comp), _alloc(x._alloc), _buffered(0)
+			{
+				this->_buffer = this->_alloc.allocate(BufferSize);
+				for (; this->_buffered < x._buffered; this->_buffered++)
+					this->_alloc.construct(this->_buffer + this->_buffered, x._buffer[this->_buffered]);
+			}
+
+			virtual ~buffered_map()
+			{
+				this->discard();
+				this->_alloc.deallocate(this->_buffer, BufferSize);
+			}
+
+			buffered_map& operator=(const buffered_map &x)
+			{
+				if (this != &x)
+				{
+					this->discard();
+					this->_tree = x._tree;
+					this->_comp = x._comp;
+					for (; this->_buffered < x._buffered; this->_buffered++)
+						this->_alloc.construct(this->_buffer + this->_buffered, x._buffer[this->_buffered]);
+				}
+				return (*this);
+			}
+
+			/*
+			** ITERATOR
+			*/
+
+			const_iterator begin() const
+			{
+				return (const_iterator(this->_tree.begin(), this->_tree.end(),
+					this->_buffer, this->_buffer + this->_buffered, this->_comp));
+			}
+
+			const_iterator end() const
+			{
+				return (const_iterator(this->_tree.end(), this->_tree.end(),
+					this->_buffer + this->_buffered, this->_buffer + this->_buffered, this->_comp));
+			}
+
+			/*
+			** CAPACITY
+			*/
+
+			bool empty() const
+			{ return (this->_tree.empty() && this->_buffered == 0); }
+
+			// a buffered key may still be in the tree: one lookup per
+			// buffered key, at most BufferSize
+			size_type size() const
+			{
+				size_type n = this->_tree.size();
+				for (size_type i = 0; i < this->_buffered; i++)
+				{
+					if (this->_tree.find(this->_buffer[i].first) == this->_tree.end())
+						n++;
+				}
+				return (n);
+			}
+
+			size_type pending() const
+			{ return (this->_buffered); }
+
+			/*
+			** ELEMENT ACCESS
+			** References stay valid until the next write.
+			*/
+
+			mapped_type& operator[](const key_type &k)
+			{
+				size_type	pos = this->search(k);
+				bool		buffered = this->holds(pos, k);
+				typename map_type::iterator it = this->_tree.find(k);
+
+				if (it != this->_tree.end())
+				{
+					if (buffered)
+						this->remove(pos);
+					return (it->second);
+				}
+				if (!buffered)
+					pos = this->add(pos, value_type(k, mapped_type()));
+				return (this->_buffer[pos].second);
+			}
+
+			/*
+			** MODIFIERS
+			*/
+
+			// the tree is not searched: whether the key was new is only known
+			// once the buffer is merged, see the note at the top
+			void insert(const value_type &val)
+			{
+				size_type pos = this->search(val.first);
+				if (!this->holds(pos, val.first))
+					this->add(pos, val);
+			}
+
+			template <class InputIterator>
+			void insert(InputIterator first, InputIterator last)
+			{
+				for (; first != last; first++)
+					this->insert(*first);
+			}
+
+			size_type erase(const key_type &k)
+			{
+				size_type	pos = this->search(k);
+				size_type	erased = this->_tree.erase(k);
+
+				if (this->holds(pos, k))
+				{
+					this->remove(pos);
+					erased = 1;
+				}
+				return (erased);
+			}
+
+			void clear()
+			{
+				this->discard();
+				this->_tree.clear();
+			}
+
+			// merges the write buffer into the tree
+			void flush()
+			{
+				if (this->_buffered == 0)
+					return ;
+				this->_tree.merge_sorted(this->_buffer, this->_buffer + this->_buffered);
+				this->discard();
+			}
+
+			/*
+			** LOOKUP
+			*/
+
+			const_iterator find(const key_type &k) const
+			{
+				size_type	pos = this->search(k);
+				typename map_type::const_iterator it = this->_tree.lower_bound(k);
+
+				if (it != this->_tree.end() && !this->_comp(k, it->first))
+					return (const_iterator(it, this->_tree.end(), this->_buffer + pos,
+						this->_buffer + this->_buffered, this->_comp));
+				if (this->holds(pos, k))
+					return (const_iterator(it, this->_tree.end(), this->_buffer + pos,
+						this->_buffer + this->_buffered, this->_comp));
+				return (this->end());
+			}
+
+			size_type count(const key_type &k) const
+			{
+				if (this->holds(this->search(k), k) || this->_tree.count(k))
+					return (1);
+				return (0);
+			}
+
+			// the underlying map, with every pending write merged in
+			const map_type& merged()
+			{
+				this->flush();
+				return (this->_tree);
+			}
+
+			key_compare key_comp() const
+			{ return (this->_comp); }
+
+			allocator_type get_allocator() const
+			{ return (this->_alloc); }
+
+		private :
+			// index of the first buffered key not less than k
+			size_type search(const key_type &k) const
+			{
+				size_type first = 0;
+				size_type len = this->_buffered;
+
+				while (len > 0)
+				{
+					size_type half = len / 2;
+					if (this->_comp(this->_buffer[first + half].first, k))
+					{
+						first += half + 1;
+						len -= half + 1;
+					}
+					else
+						len = half;
+				}
+				return (first);
+			}
+
+			bool holds(size_type pos, const key_type &k) const
+			{ return (pos < this->_buffered && !this->_comp(k, this->_buffer[pos].first)); }
+
+			// the key is const, so elements are shifted by copy and destroy
+			size_type add(size_type pos, const value_type &val)
+			{
+				if (this->_buffered == BufferSize)
+				{
+					value_type tmp(val);
+					this->flush();
+					this->_alloc.construct(this->_buffer, tmp);
+					this->_buffered = 1;
+					return (0);
+				}
+				for (size_type i = this->_buffered; i > pos; i--)
+				{
+					this->_alloc.construct(this->_buffer + i, this->_buffer[i - 1]);
+					this->_alloc.destroy(this->_buffer + i - 1);
+				}
+				this->_alloc.construct(this->_buffer + pos, val);
+				this->_buffered++;
+				return (pos);
+			}
+
+			void remove(size_type pos)
+			{
+				this->_alloc.destroy(this->_buffer + pos);
+				for (size_type i = pos + 1; i < this->_buffered; i++)
+				{
+					this->_alloc.construct(this->_buffer + i - 1, this->_buffer[i]);
+					this->_alloc.destroy(this->_buffer + i);
+				}
+				this->_buffered--;
+			}
+
+			void discard()
+			{
+				for (size_type i = 0; i < this->_buffered; i++)
+					this->_alloc.destroy(this->_buffer + i);
+				this->_buffered = 0;
+			}
+
+			map_type		_tree;
+			key_compare		_comp;
+			allocator_type	_alloc;
+			value_type		*_buffer;
+			size_type		_buffered;
+	};
+}
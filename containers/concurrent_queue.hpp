@@ -0,0 +1,392 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_queue.hpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+/*
+** CONCURRENT QUEUES
+** Bounded lock-free FIFOs over a ring of power-of-two size, C++11 only.
+** Elements are built in the ring's slots and never allocated one by one;
+** push fails when the ring is full, pop when it is empty, neither waits.
+** spsc_queue<T, N> links one producer thread to one consumer thread and
+** holds its N slots inline. Each side owns one index, on its own cache line,
+** and keeps a copy of the other side's index: it only reads the other
+** line again when that copy says the ring is full (or empty), so the two
+** threads rarely touch each other's lines. push_n / pop_n move a whole
+** batch for one index update.
+** mpmc_queue<T> takes any number of producers and consumers (Dmitry
+** Vyukov's bounded queue). Each slot carries a sequence number telling
+** which turn of the ring it is ready for: a thread claims a slot with one
+** compare-and-swap on the shared index, then fills or empties it and
+** hands it over by bumping its sequence, without a lock.
+** size() is approximate while other threads push or pop. Destruction must
+** not run concurrently with anything.
+*/
+
+#if __cplusplus >= 201103L
+
+# include <new>
+# include <atomic>
+# include <memory>
+# include <limits>
+# include <cstddef>
+# include <utility>
+# include <stdexcept>
+# include <type_traits>
+# include "../utils/memory.hpp"
+
+namespace ft
+{
+	/*
+	** SINGLE PRODUCER, SINGLE CONSUMER
+	*/
+
+	// the push functions may only be called by one thread at a time, and the
+	// pop functions by one (other) thread at a time
+	template<class T, std::size_t N>
+	class spsc_queue
+	{
+		static_assert(N >= 2 && (N & (N - 1)) == 0, "spsc_queue: N must be a power of two");
+
+		public:
+			typedef T				value_type;
+			typedef std::size_t		size_type;
+
+			spsc_queue()
+			: _head(0), _tail_cache(0), _tail(0), _head_cache(0) {}
+
+			spsc_queue(const spsc_queue &) = delete;
+			spsc_queue &operator=(const spsc_queue &) = delete;
+
+			~spsc_queue()
+			{
+				size_type tail = _tail.load(std::memory_order_relaxed);
+				for (size_type i = _head.load(std::memory_order_relaxed); i != tail; i++)
+					this->slot(i)->~value_type();
+			}
+
+			/*
+			** PRODUCER
+			*/
+
+			// false if the queue is full
+			bool try_push(const value_type &val)
+			{ return (this->try_emplace(val)); }
+
+			bool try_push(value_type &&val)
+			{ return (this->try_emplace(std::move(val))); }
+
+			template<class... Args>
+			bool try_emplace(Args&&... args)
+			{
+				size_type tail = _tail.load(std::memory_order_relaxed);
+				if (this->free_slots(tail, 1) == 0)
+					return (false);
+				::new (static_cast<void *>(this->slot(tail))) value_type(std::forward<Args>(args)...);
+				_tail.store(tail + 1, std::memory_order_release);
+				return (true);
+			}
+
+			// copies up to n elements from first (moves them through a
+			// move_iterator), as many as there is room for; returns how many.
+			// If a copy throws the ones before it stay queued
+			template<class InputIt>
+			size_type push_n(InputIt first, size_type n)
+			{
+				size_type tail = _tail.load(std::memory_order_relaxed);
+				size_type i = 0;
+
+				n = this->free_slots(tail, n);
+				try
+				{
+					for (; i < n; i++, ++first)
+						::new (static_cast<void *>(this->slot(tail + i))) value_type(*first);
+				}
+				catch (...)
+				{
+					_tail.store(tail + i, std::memory_order_release);
+					throw ;
+				}
+				_tail.store(tail + n, std::memory_order_release);
+				return (n);
+			}
+
+			/*
+			** CONSUMER
+			*/
+
+			// false if the queue was empty, out is left untouched then; if
+			// moving into out throws the element stays at the front
+			bool try_pop(value_type &out)
+			{ return (this->pop_n(&out, 1) == 1); }
+
+			// moves up to n elements to out, as many as are queued; returns
+			// how many. If a move throws that element stays at the front
+			template<class OutputIt>
+			size_type pop_n(OutputIt out, size_type n)
+			{
+				size_type head = _head.load(std::memory_order_relaxed);
+				size_type i = 0;
+
+				n = this->ready_slots(head, n);
+				try
+				{
+					for (; i < n; i++, ++out)
+					{
+						value_type *val = this->slot(head + i);
+						*out = std::move(*val);
+						val->~value_type();
+					}
+				}
+				catch (...)
+				{
+					_head.store(head + i, std::memory_order_release);
+					throw ;
+				}
+				_head.store(head + n, std::memory_order_release);
+				return (n);
+			}
+
+			/*
+			** EITHER SIDE
+			*/
+
+			// exact when called by the producer or the consumer while the
+			// other side is idle
+			size_type size() const
+			{
+				size_type head = _head.load(std::memory_order_acquire);
+				return (_tail.load(std::memory_order_acquire) - head);
+			}
+
+			bool empty() const
+			{ return (this->size() == 0); }
+
+			size_type capacity() const
+			{ return (N); }
+
+		private:
+			typedef typename std::aligned_storage<sizeof(T), alignof(T)>::type	slot_type;
+
+			// indices only grow, slot i % N holds element i
+			alignas(cache_line_size) std::atomic<size_type>	_head;
+			size_type										_tail_cache;
+			alignas(cache_line_size) std::atomic<size_type>	_tail;
+			size_type										_head_cache;
+			alignas(cache_line_size) alignas(slot_type) slot_type	_slots[N];
+
+			value_type *slot(size_type i)
+			{ return (reinterpret_cast<value_type *>(_slots + (i & (N - 1)))); }
+
+			// producer side: how many of wanted slots are free at tail
+			size_type free_slots(size_type tail, size_type wanted)
+			{
+				if (N - (tail - _head_cache) < wanted)
+					_head_cache = _head.load(std::memory_order_acquire);
+				size_type room = N - (tail - _head_cache);
+				return (wanted < room ? wanted : room);
+			}
+
+			// consumer side: how many of wanted elements are built at head
+			size_type ready_slots(size_type head, size_type wanted)
+			{
+				if (_tail_cache - head < wanted)
+					_tail_cache = _tail.load(std::memory_order_acquire);
+				size_type ready = _tail_cache - head;
+				return (wanted < ready ? wanted : ready);
+			}
+	};
+
+	/*
+	** MULTIPLE PRODUCERS, MULTIPLE CONSUMERS
+	*/
+
+	template<class T>
+	struct queue_cell
+	{
+		// pos when ready for the push claiming pos, pos + 1 when ready for
+		// the pop claiming pos
+		std::atomic<std::size_t>										sequence;
+		// false when T's constructor threw: the pop claiming it skips it
+		bool															full;
+		typename std::aligned_storage<sizeof(T), alignof(T)>::type		storage;
+
+		explicit queue_cell(std::size_t pos) : sequence(pos), full(false) {}
+
+		T *value()
+		{ return (reinterpret_cast<T *>(&storage)); }
+	};
+
+	template<class T, class Alloc = std::allocator<T> >
+	class mpmc_queue
+	{
+		private:
+			typedef queue_cell<T>											cell_type;
+			typedef typename Alloc::template rebind<cell_type>::other		cell_allocator_type;
+
+		public:
+			typedef T				value_type;
+			typedef Alloc			allocator_type;
+			typedef std::size_t		size_type;
+
+			// capacity is rounded up to a power of two, at least 2
+			explicit mpmc_queue(size_type capacity, const allocator_type &alloc = allocator_type())
+			: _cells(NULL), _mask(0), _alloc(alloc), _cell_alloc(alloc), _enqueue(0), _dequeue(0)
+			{
+				size_type size = 2;
+				while (size < capacity)
+				{
+					if (size > std::numeric_limits<size_type>::max() / 2 / sizeof(cell_type))
+						throw std::length_error("mpmc_queue");
+					size <<= 1;
+				}
+				_cells = _cell_alloc.allocate(size);
+				_mask = size - 1;
+				for (size_type i = 0; i < size; i++)
+					::new (static_cast<void *>(_cells + i)) cell_type(i);
+			}
+
+			mpmc_queue(const mpmc_queue &) = delete;
+			mpmc_queue &operator=(const mpmc_queue &) = delete;
+
+			~mpmc_queue()
+			{
+				size_type end = _enqueue.load(std::memory_order_relaxed);
+				for (size_type pos = _dequeue.load(std::memory_order_relaxed); pos != end; pos++)
+				{
+					cell_type &cell = _cells[pos & _mask];
+					if (cell.full)
+						_alloc.destroy(cell.value());
+				}
+				for (size_type i = 0; i <= _mask; i++)
+					_cells[i].~cell_type();
+				_cell_alloc.deallocate(_cells, _mask + 1);
+			}
+
+			// false if the queue is full
+			bool try_push(const value_type &val)
+			{ return (this->try_emplace(val)); }
+
+			bool try_push(value_type &&val)
+			{ return (this->try_emplace(std::move(val))); }
+
+			// if T's constructor throws the claimed slot is handed over empty
+			template<class... Args>
+			bool try_emplace(Args&&... args)
+			{
+				size_type	pos;
+				cell_type	*cell = this->claim(_enqueue, 0, pos);
+
+				if (cell == NULL)
+					return (false);
+				try
+				{
+					_alloc.construct(cell->value(), std::forward<Args>(args)...);
+				}
+				catch (...)
+				{
+					cell->full = false;
+					cell->sequence.store(pos + 1, std::memory_order_release);
+					throw ;
+				}
+				cell->full = true;
+				cell->sequence.store(pos + 1, std::memory_order_release);
+				return (true);
+			}
+
+			// false if the queue was empty, out is left untouched then; if
+			// moving into out throws the element is destroyed and lost, as
+			// the slots after it may already be taken
+			bool try_pop(value_type &out)
+			{
+				size_type	pos;
+				cell_type	*cell;
+
+				while ((cell = this->claim(_dequeue, 1, pos)) != NULL)
+				{
+					if (cell->full)
+						break ;
+					this->recycle(cell, pos);
+				}
+				if (cell == NULL)
+					return (false);
+				try
+				{
+					out = std::move(*cell->value());
+				}
+				catch (...)
+				{
+					_alloc.destroy(cell->value());
+					this->recycle(cell, pos);
+					throw ;
+				}
+				_alloc.destroy(cell->value());
+				this->recycle(cell, pos);
+				return (true);
+			}
+
+			// exact when no other thread is pushing or popping
+			size_type size() const
+			{
+				size_type head = _dequeue.load(std::memory_order_acquire);
+				size_type n = _enqueue.load(std::memory_order_acquire) - head;
+				return (n > _mask + 1 ? _mask + 1 : n);
+			}
+
+			bool empty() const
+			{ return (this->size() == 0); }
+
+			size_type capacity() const
+			{ return (_mask + 1); }
+
+			allocator_type get_allocator() const
+			{ return (_alloc); }
+
+		private:
+			cell_type				*_cells;
+			size_type				_mask;
+			allocator_type			_alloc;
+			cell_allocator_type		_cell_alloc;
+			// producers and consumers each hammer their own index, the
+			// alignment pads the object's end too
+			alignas(cache_line_size) std::atomic<size_type>	_enqueue;
+			alignas(cache_line_size) std::atomic<size_type>	_dequeue;
+
+			// takes the slot at index (its sequence is pos + lag when ready), NULL
+			// if it still holds the previous turn: the queue is full, or empty
+			cell_type *claim(std::atomic<size_type> &index, size_type lag, size_type &pos)
+			{
+				pos = index.load(std::memory_order_relaxed);
+				for (;;)
+				{
+					cell_type *cell = _cells + (pos & _mask);
+					std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(
+						cell->sequence.load(std::memory_order_acquire) - (pos + lag));
+					if (diff == 0)
+					{
+						if (index.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+							return (cell);
+					}
+					else if (diff < 0)
+						return (NULL);
+					else
+						pos = index.load(std::memory_order_relaxed);
+				}
+			}
+
+			// the slot popped at pos is ready for the push one turn later
+			void recycle(cell_type *cell, size_type pos)
+			{ cell->sequence.store(pos + _mask + 1, std::memory_order_release); }
+	};
+}
+
+#endif
@@ -0,0 +1,326 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_stack.hpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+/*
+** CONCURRENT STACKS
+** Lock-free LIFOs any number of threads can push to and pop from at once,
+** C++11 only (Treiber stacks). concurrent_stack grows as needed,
+** bounded_concurrent_stack holds at most the capacity it is built with and
+** never allocates afterwards.
+** Elements live in nodes, found by their 32 bits index. The top of the stack
+** packs the index of the top node with a counter bumped by every change, in
+** one 64 bits word swapped with compare-and-swap: a thread that read the top,
+** stalled while the node was popped and pushed again, fails its swap instead
+** of linking a stale node (the ABA problem). Popped nodes are not freed but
+** kept on a second such list for the next pushes, so a stalled thread can
+** still read a node after another thread popped it; they are all freed with
+** the stack.
+** size() is approximate while other threads push or pop. Destruction must
+** not run concurrently with anything.
+*/
+
+#if __cplusplus >= 201103L
+
+# include <new>
+# include <atomic>
+# include <memory>
+# include <cstddef>
+# include <utility>
+# include <stdint.h>
+# include <stdexcept>
+# include <type_traits>
+# include "concurrent_vector.hpp"
+# include "../utils/memory.hpp"
+
+namespace ft
+{
+	/*
+	** TAGGED LIST
+	*/
+
+	// a lock-free LIFO of node indices, nodes[i].next links them
+	class alignas(cache_line_size) tagged_list
+	{
+		public:
+			tagged_list() : _head(0) {}
+
+			bool empty() const
+			{ return (link(_head.load(std::memory_order_acquire)) == 0); }
+
+			template<class Nodes>
+			void push(Nodes &nodes, uint32_t i)
+			{
+				uint64_t head = _head.load(std::memory_order_relaxed);
+				do
+					nodes[i].next.store(link(head), std::memory_order_relaxed);
+				while (!_head.compare_exchange_weak(head, retag(head, i + 1),
+					std::memory_order_release, std::memory_order_relaxed));
+			}
+
+			template<class Nodes>
+			bool pop(Nodes &nodes, uint32_t &i)
+			{
+				uint64_t head = _head.load(std::memory_order_acquire);
+				uint32_t next;
+				do
+				{
+					if (link(head) == 0)
+						return (false);
+					next = nodes[link(head) - 1].next.load(std::memory_order_relaxed);
+				}
+				while (!_head.compare_exchange_weak(head, retag(head, next),
+					std::memory_order_acquire, std::memory_order_acquire));
+				i = link(head) - 1;
+				return (true);
+			}
+
+		private:
+			// counter in the high half, index + 1 in the low one, 0 ends the list
+			std::atomic<uint64_t>	_head;
+
+			static uint32_t link(uint64_t head)
+			{ return (static_cast<uint32_t>(head)); }
+
+			static uint64_t retag(uint64_t head, uint32_t next)
+			{ return ((((head >> 32) + 1) << 32) | next); }
+	};
+
+	template<class T>
+	struct stack_node
+	{
+		std::atomic<uint32_t>											next;
+		typename std::aligned_storage<sizeof(T), alignof(T)>::type		storage;
+
+		stack_node() : next(0) {}
+
+		T *value()
+		{ return (reinterpret_cast<T *>(&storage)); }
+	};
+
+	/*
+	** COMMON PART
+	*/
+
+	// Nodes is anything indexable giving stack_node<T>&
+	template<class T, class Alloc, class Nodes>
+	class basic_concurrent_stack
+	{
+		public:
+			typedef T				value_type;
+			typedef Alloc			allocator_type;
+			typedef std::size_t		size_type;
+
+			basic_concurrent_stack(const basic_concurrent_stack &) = delete;
+			basic_concurrent_stack &operator=(const basic_concurrent_stack &) = delete;
+
+			// false if the stack was empty, out is left untouched then; if
+			// moving into out throws the element goes back on top
+			bool try_pop(value_type &out)
+			{
+				uint32_t i;
+				if (!_values.pop(_nodes, i))
+					return (false);
+				_count.fetch_sub(1, std::memory_order_relaxed);
+				value_type *val = _nodes[i].value();
+				try
+				{
+					out = std::move(*val);
+				}
+				catch (...)
+				{
+					this->publish(i);
+					throw ;
+				}
+				_alloc.destroy(val);
+				_free.push(_nodes, i);
+				return (true);
+			}
+
+			// exact when no other thread is pushing or popping
+			size_type size() const
+			{
+				std::ptrdiff_t n = _count.load(std::memory_order_relaxed);
+				return (n < 0 ? 0 : static_cast<size_type>(n));
+			}
+
+			bool empty() const
+			{ return (_values.empty()); }
+
+			allocator_type get_allocator() const
+			{ return (_alloc); }
+
+		protected:
+			// the largest index a node can have, one below the list's end marker
+			static const uint32_t	max_nodes = 0xfffffffe;
+
+			Nodes					_nodes;
+			tagged_list				_values;
+			tagged_list				_free;
+			std::atomic<std::ptrdiff_t>	_count;
+			allocator_type			_alloc;
+
+			explicit basic_concurrent_stack(const allocator_type &alloc)
+			: _nodes(), _count(0), _alloc(alloc) {}
+
+			~basic_concurrent_stack() {}
+
+			// builds an element in node i and puts it on top
+			template<class... Args>
+			void fill(uint32_t i, Args&&... args)
+			{
+				try
+				{
+					_alloc.construct(_nodes[i].value(), std::forward<Args>(args)...);
+				}
+				catch (...)
+				{
+					_free.push(_nodes, i);
+					throw ;
+				}
+				this->publish(i);
+			}
+
+			void publish(uint32_t i)
+			{
+				_values.push(_nodes, i);
+				_count.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			void destroy_values()
+			{
+				uint32_t i;
+				while (_values.pop(_nodes, i))
+					_alloc.destroy(_nodes[i].value());
+			}
+	};
+
+	/*
+	** UNBOUNDED
+	*/
+
+	// nodes come from a concurrent_vector, which grows without moving them
+	template<class T, class Alloc = std::allocator<T> >
+	class concurrent_stack
+	: public basic_concurrent_stack<T, Alloc,
+		concurrent_vector<stack_node<T>, typename Alloc::template rebind<stack_node<T> >::other> >
+	{
+		private:
+			typedef basic_concurrent_stack<T, Alloc, concurrent_vector<stack_node<T>,
+				typename Alloc::template rebind<stack_node<T> >::other> >	base;
+
+		public:
+			typedef typename base::value_type		value_type;
+			typedef typename base::allocator_type	allocator_type;
+			typedef typename base::size_type		size_type;
+
+			explicit concurrent_stack(const allocator_type &alloc = allocator_type())
+			: base(alloc) {}
+
+			~concurrent_stack()
+			{ this->destroy_values(); }
+
+			void push(const value_type &val)
+			{ this->emplace(val); }
+
+			void push(value_type &&val)
+			{ this->emplace(std::move(val)); }
+
+			template<class... Args>
+			void emplace(Args&&... args)
+			{ this->fill(this->node(), std::forward<Args>(args)...); }
+
+			// makes room for n elements ahead of time
+			void reserve(size_type n)
+			{ this->_nodes.reserve(n); }
+
+		private:
+			// a recycled node, a new one otherwise
+			uint32_t node()
+			{
+				uint32_t i;
+				if (this->_free.pop(this->_nodes, i))
+					return (i);
+				size_type index = this->_nodes.emplace_back().index();
+				if (index > base::max_nodes)
+					throw std::length_error("concurrent_stack::push");
+				return (static_cast<uint32_t>(index));
+			}
+	};
+
+	/*
+	** BOUNDED
+	*/
+
+	// the nodes are one array allocated up front
+	template<class T, class Alloc = std::allocator<T> >
+	class bounded_concurrent_stack
+	: public basic_concurrent_stack<T, Alloc, stack_node<T> *>
+	{
+		private:
+			typedef basic_concurrent_stack<T, Alloc, stack_node<T> *>			base;
+			typedef typename Alloc::template rebind<stack_node<T> >::other	node_allocator_type;
+
+			node_allocator_type	_node_alloc;
+			uint32_t			_capacity;
+
+		public:
+			typedef typename base::value_type		value_type;
+			typedef typename base::allocator_type	allocator_type;
+			typedef typename base::size_type		size_type;
+
+			explicit bounded_concurrent_stack(size_type capacity, const allocator_type &alloc = allocator_type())
+			: base(alloc), _node_alloc(alloc), _capacity(0)
+			{
+				if (capacity > static_cast<size_type>(base::max_nodes) + 1)
+					throw std::length_error("bounded_concurrent_stack");
+				this->_nodes = _node_alloc.allocate(capacity);
+				_capacity = static_cast<uint32_t>(capacity);
+				for (uint32_t i = _capacity; i > 0; i--)
+				{
+					::new (static_cast<void *>(this->_nodes + (i - 1))) stack_node<T>();
+					this->_free.push(this->_nodes, i - 1);
+				}
+			}
+
+			~bounded_concurrent_stack()
+			{
+				this->destroy_values();
+				for (uint32_t i = 0; i < _capacity; i++)
+					this->_nodes[i].~stack_node<T>();
+				_node_alloc.deallocate(this->_nodes, _capacity);
+			}
+
+			// false if the stack is full
+			bool push(const value_type &val)
+			{ return (this->emplace(val)); }
+
+			bool push(value_type &&val)
+			{ return (this->emplace(std::move(val))); }
+
+			template<class... Args>
+			bool emplace(Args&&... args)
+			{
+				uint32_t i;
+				if (!this->_free.pop(this->_nodes, i))
+					return (false);
+				this->fill(i, std::forward<Args>(args)...);
+				return (true);
+			}
+
+			size_type capacity() const
+			{ return (_capacity); }
+	};
+}
+
+#endif
@@ -0,0 +1,519 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_vector.hpp                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+/*
+** CONCURRENT VECTOR
+** A vector several threads can append to at once, C++11 only. Storage is
+** a table of segments: segment k holds first_segment << k elements, so
+** element i lives in segment log2(i / first_segment + 1) and elements never
+** move once built. push_back and grow_by reserve their slots with one
+** fetch_add on the size; the first thread needing a missing segment
+** allocates it and publishes it with a compare-and-swap (a thread losing
+** that race frees its copy), so no thread ever waits for another.
+** size() counts the reserved slots, some of which may still be under
+** construction: an element can be read by index, from any thread, once its
+** push_back returned and that is known to the reader (through the value
+** returned, a join, an atomic...). Reads never block appends.
+** clear(), swap() and destruction must not run concurrently with anything.
+** If T's constructor throws, the slot stays empty and is skipped on
+** destruction; reading it is undefined.
+*/
+
+#if __cplusplus >= 201103L
+
+# include <new>
+# include <mutex>
+# include <atomic>
+# include <vector>
+# include <memory>
+# include <cstddef>
+# include <utility>
+# include <stdexcept>
+# include <algorithm>
+# include "../utils/utils.hpp"
+# include "../utils/hardening.hpp"
+# include "../utils/type_traits.hpp"
+# include "../iterator/iterator.hpp"
+
+namespace ft
+{
+	template<class T, class Alloc = std::allocator<T> >
+	class concurrent_vector
+	{
+		public:
+			typedef T					value_type;
+			typedef Alloc				allocator_type;
+			typedef	std::size_t			size_type;
+			typedef	std::ptrdiff_t		difference_type;
+			typedef T&					reference;
+			typedef const T&			const_reference;
+			typedef T*					pointer;
+			typedef const T*			const_pointer;
+
+			// an index into the vector, elements are found again on every access
+			template<class Vector, class Value>
+			class basic_iterator
+			{
+				public:
+					typedef std::ptrdiff_t						difference_type;
+					typedef Value								value_type;
+					typedef Value*								pointer;
+					typedef Value&								reference;
+					typedef ft::random_access_iterator_tag		iterator_category;
+
+					basic_iterator() : _vector(NULL), _index(0) {}
+
+					basic_iterator(Vector *vector, size_type index) : _vector(vector), _index(index) {}
+
+					template<class V, class U>
+					basic_iterator(const basic_iterator<V, U> &other)
+					: _vector(other.container()), _index(other.index()) {}
+
+					Vector *container() const
+					{ return (_vector); }
+
+					size_type index() const
+					{ return (_index); }
+
+					reference operator*() const
+					{ return ((*_vector)[_index]); }
+
+					pointer operator->() const
+					{ return (&(*_vector)[_index]); }
+
+					reference operator[](difference_type n) const
+					{ return ((*_vector)[_index + n]); }
+
+					basic_iterator &operator++()
+					{ ++_index; return (*this); }
+
+					basic_iterator operator++(int)
+					{ basic_iterator tmp(*this); ++_index; return (tmp); }
+
+					basic_iterator &operator--()
+					{ --_index; return (*this); }
+
+					basic_iterator operator--(int)
+					{ basic_iterator tmp(*this); --_index; return (tmp); }
+
+					basic_iterator &operator+=(difference_type n)
+					{ _index += n; return (*this); }
+
+					basic_iterator &operator-=(difference_type n)
+					{ _index -= n; return (*this); }
+
+					basic_iterator operator+(difference_type n) const
+					{ return (basic_iterator(_vector, _index + n)); }
+
+					basic_iterator operator-(difference_type n) const
+					{ return (basic_iterator(_vector, _index - n)); }
+
+					template<class V, class U>
+					difference_type operator-(const basic_iterator<V, U> &rhs) const
+					{ return (static_cast<difference_type>(_index - rhs.index())); }
+
+					template<class V, class U>
+					bool operator==(const basic_iterator<V, U> &rhs) const
+					{ return (_index == rhs.index()); }
+
+					template<class V, class U>
+					bool operator!=(const basic_iterator<V, U> &rhs) const
+					{ return (_index != rhs.index()); }
+
+					template<class V, class U>
+					bool operator<(const basic_iterator<V, U> &rhs) const
+					{ return (_index < rhs.index()); }
+
+					template<class V, class U>
+					bool operator>(const basic_iterator<V, U> &rhs) const
+					{ return (_index > rhs.index()); }
+
+					template<class V, class U>
+					bool operator<=(const basic_iterator<V, U> &rhs) const
+					{ return (_index <= rhs.index()); }
+
+					template<class V, class U>
+					bool operator>=(const basic_iterator<V, U> &rhs) const
+					{ return (_index >= rhs.index()); }
+
+				private:
+					Vector		*_vector;
+					size_type	_index;
+			};
+
+			typedef basic_iterator<concurrent_vector, T>				iterator;
+			typedef basic_iterator<const concurrent_vector, const T>	const_iterator;
+			typedef ft::reverse_iterator<iterator>						reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>				const_reverse_iterator;
+
+		private:
+			static const size_type	first_segment_bits = 5;
+			static const size_type	first_segment = static_cast<size_type>(1) << first_segment_bits;
+			static const size_type	segments = sizeof(size_type) * 8 - first_segment_bits;
+
+			allocator_type			_alloc;
+			std::atomic<size_type>	_size;
+			std::atomic<pointer>	_table[segments];
+			mutable std::mutex		_broken_mutex;
+			std::vector<size_type>	_broken; // slots whose constructor threw
+
+		public:
+			explicit concurrent_vector(const allocator_type &alloc = allocator_type())
+			: _alloc(alloc), _size(0)
+			{
+				for (size_type k = 0; k < segments; k++)
+					_table[k].store(NULL, std::memory_order_relaxed);
+			}
+
+			concurrent_vector(size_type n, const value_type &val,
+					const allocator_type &alloc = allocator_type())
+			: concurrent_vector(alloc)
+			{ this->grow_by(n, val); }
+
+			// the slots broken in other are broken in the copy, at the same index
+			concurrent_vector(const concurrent_vector &other)
+			: concurrent_vector(other._alloc)
+			{
+				size_type				n = other.size();
+				std::vector<size_type>	broken = other.broken_slots();
+
+				std::vector<size_type>::const_iterator it = broken.begin();
+				this->reserve(n);
+				for (size_type i = 0; i < n; i++)
+				{
+					if (it != broken.end() && *it == i)
+					{
+						_size.fetch_add(1, std::memory_order_relaxed);
+						this->lose(i, i + 1);
+						++it;
+					}
+					else
+						this->push_back(other[i]);
+				}
+			}
+
+			~concurrent_vector()
+			{ this->release(); }
+
+			concurrent_vector &operator=(const concurrent_vector &other)
+			{
+				if (this != &other)
+					concurrent_vector(other).swap(*this);
+				return (*this);
+			}
+
+			/*
+			** ITERATORS
+			*/
+
+			iterator begin()
+			{ return (iterator(this, 0)); }
+
+			const_iterator begin() const
+			{ return (const_iterator(this, 0)); }
+
+			iterator end()
+			{ return (iterator(this, this->size())); }
+
+			const_iterator end() const
+			{ return (const_iterator(this, this->size())); }
+
+			reverse_iterator rbegin()
+			{ return (reverse_iterator(this->end())); }
+
+			const_reverse_iterator rbegin() const
+			{ return (const_reverse_iterator(this->end())); }
+
+			reverse_iterator rend()
+			{ return (reverse_iterator(this->begin())); }
+
+			const_reverse_iterator rend() const
+			{ return (const_reverse_iterator(this->begin())); }
+
+			/*
+			** CAPACITY
+			*/
+
+			size_type size() const
+			{ return (_size.load(std::memory_order_acquire)); }
+
+			bool empty() const
+			{ return (this->size() == 0); }
+
+			size_type max_size() const
+			{ return (std::min<size_type>(_alloc.max_size(), ~static_cast<size_type>(0) - first_segment)); }
+
+			// elements the allocated segments hold
+			size_type capacity() const
+			{
+				size_type k = 0;
+				while (k < segments && _table[k].load(std::memory_order_acquire) != NULL)
+					k++;
+				return (segment_base(k));
+			}
+
+			// allocates the segments up to n elements, may run concurrently
+			void reserve(size_type n)
+			{
+				if (n > this->max_size())
+					throw std::length_error("concurrent_vector::reserve");
+				for (size_type k = 0; n && k <= segment_of(n - 1); k++)
+					this->segment(k);
+			}
+
+			/*
+			** ELEMENT ACCESS
+			*/
+
+			reference operator[](size_type n)
+			{
+				FT_CHECK(n < this->size(), "concurrent_vector::operator[]: index out of range");
+				return (this->slot(n));
+			}
+
+			const_reference operator[](size_type n) const
+			{
+				FT_CHECK(n < this->size(), "concurrent_vector::operator[]: index out of range");
+				return (const_cast<concurrent_vector *>(this)->slot(n));
+			}
+
+			reference at(size_type n)
+			{
+				if (n >= this->size())
+					throw std::out_of_range("Out of range");
+				return (this->slot(n));
+			}
+
+			const_reference at(size_type n) const
+			{
+				if (n >= this->size())
+					throw std::out_of_range("Out of range");
+				return (const_cast<concurrent_vector *>(this)->slot(n));
+			}
+
+			reference front()
+			{
+				FT_CHECK(!this->empty(), "concurrent_vector::front: empty vector");
+				return (this->slot(0));
+			}
+
+			const_reference front() const
+			{
+				FT_CHECK(!this->empty(), "concurrent_vector::front: empty vector");
+				return (const_cast<concurrent_vector *>(this)->slot(0));
+			}
+
+			/*
+			** MODIFIERS (CONCURRENT)
+			*/
+
+			// the new element's position
+			iterator push_back(const value_type &val)
+			{ return (this->emplace_back(val)); }
+
+			iterator push_back(value_type &&val)
+			{ return (this->emplace_back(std::move(val))); }
+
+			template<class... Args>
+			iterator emplace_back(Args&&... args)
+			{
+				size_type i = _size.fetch_add(1, std::memory_order_acq_rel);
+				try
+				{
+					this->construct(i, std::forward<Args>(args)...);
+				}
+				catch (...)
+				{
+					this->lose(i, i + 1);
+					throw ;
+				}
+				return (iterator(this, i));
+			}
+
+			// appends n copies of val, the first new position
+			iterator grow_by(size_type n, const value_type &val = value_type())
+			{
+				size_type	start = _size.fetch_add(n, std::memory_order_acq_rel);
+				size_type	i = start;
+
+				try
+				{
+					for (; i < start + n; i++)
+						this->construct(i, val);
+				}
+				catch (...)
+				{
+					this->lose(i, start + n);
+					throw ;
+				}
+				return (iterator(this, start));
+			}
+
+			// appends [first, last), the first new position
+			template<class ForwardIterator>
+			iterator grow_by(ForwardIterator first,
+					typename ft::enable_if<!is_integral<ForwardIterator>::value, ForwardIterator>::type last)
+			{
+				size_type	n = static_cast<size_type>(ft::distance(first, last));
+				size_type	start = _size.fetch_add(n, std::memory_order_acq_rel);
+				size_type	i = start;
+
+				try
+				{
+					for (; first != last; ++first, ++i)
+						this->construct(i, *first);
+				}
+				catch (...)
+				{
+					this->lose(i, start + n);
+					throw ;
+				}
+				return (iterator(this, start));
+			}
+
+			/*
+			** MODIFIERS (EXCLUSIVE)
+			*/
+
+			// keeps the segments
+			void clear()
+			{
+				this->destroy_elements();
+				_size.store(0, std::memory_order_release);
+			}
+
+			// frees the segments the elements do not need
+			void shrink_to_fit()
+			{
+				size_type used = (this->empty() ? 0 : segment_of(this->size() - 1) + 1);
+				for (size_type k = used; k < segments; k++)
+					this->free_segment(k);
+			}
+
+			void swap(concurrent_vector &other)
+			{
+				std::swap(_alloc, other._alloc);
+				size_type size = _size.load();
+				_size.store(other._size.load());
+				other._size.store(size);
+				for (size_type k = 0; k < segments; k++)
+				{
+					pointer seg = _table[k].load();
+					_table[k].store(other._table[k].load());
+					other._table[k].store(seg);
+				}
+				_broken.swap(other._broken);
+			}
+
+			allocator_type get_allocator() const
+			{ return (_alloc); }
+
+		private:
+			/*
+			** SEGMENTS
+			*/
+
+			static size_type highest_bit(size_type n)
+			{ return (sizeof(size_type) * 8 - 1 - __builtin_clzl(n)); }
+
+			static size_type segment_of(size_type i)
+			{ return (highest_bit((i >> first_segment_bits) + 1)); }
+
+			// index of the first element of segment k
+			static size_type segment_base(size_type k)
+			{ return ((first_segment << k) - first_segment); }
+
+			static size_type segment_size(size_type k)
+			{ return (first_segment << k); }
+
+			// segment k, allocated by the first thread needing it
+			pointer segment(size_type k)
+			{
+				pointer seg = _table[k].load(std::memory_order_acquire);
+				if (seg != NULL)
+					return (seg);
+				pointer mem = _alloc.allocate(segment_size(k));
+				if (_table[k].compare_exchange_strong(seg, mem, std::memory_order_acq_rel))
+					return (mem);
+				_alloc.deallocate(mem, segment_size(k));
+				return (seg);
+			}
+
+			reference slot(size_type i)
+			{
+				size_type k = segment_of(i);
+				return (_table[k].load(std::memory_order_acquire)[i - segment_base(k)]);
+			}
+
+			template<class... Args>
+			void construct(size_type i, Args&&... args)
+			{
+				size_type k = segment_of(i);
+				_alloc.construct(this->segment(k) + (i - segment_base(k)), std::forward<Args>(args)...);
+			}
+
+			// the slots [first, last) were reserved but will never be built
+			void lose(size_type first, size_type last)
+			{
+				std::lock_guard<std::mutex> lock(_broken_mutex);
+				for (; first < last; first++)
+					_broken.push_back(first);
+			}
+
+			// sorted
+			std::vector<size_type> broken_slots() const
+			{
+				std::lock_guard<std::mutex> lock(_broken_mutex);
+				std::vector<size_type> broken(_broken);
+				std::sort(broken.begin(), broken.end());
+				return (broken);
+			}
+
+			void destroy_elements()
+			{
+				size_type n = this->size();
+				std::sort(_broken.begin(), _broken.end());
+				std::vector<size_type>::const_iterator broken = _broken.begin();
+				for (size_type i = 0; i < n; i++)
+				{
+					if (broken != _broken.end() && *broken == i)
+						++broken;
+					else
+						_alloc.destroy(&this->slot(i));
+				}
+				_broken.clear();
+			}
+
+			void free_segment(size_type k)
+			{
+				pointer seg = _table[k].exchange(NULL);
+				if (seg != NULL)
+					_alloc.deallocate(seg, segment_size(k));
+			}
+
+			void release()
+			{
+				this->destroy_elements();
+				for (size_type k = 0; k < segments; k++)
+					this->free_segment(k);
+				_size.store(0);
+			}
+	};
+
+	template<class T, class Alloc>
+	void swap(concurrent_vector<T, Alloc> &lhs, concurrent_vector<T, Alloc> &rhs)
+	{ lhs.swap(rhs); }
+}
+
+#endif
@@ -0,0 +1,779 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   deque.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+/*
+** DEQUE
+** Elements live in fixed blocks of about 4KB, listed in order by a map of
+** block pointers with free slots at both ends. push_back and push_front
+** construct in place and never move the other elements: when a block fills
+** up the next one is allocated, and only the map (one pointer per block) is
+** ever copied to a bigger one, so the worst push costs size() / block
+** pointers copied instead of size() elements.
+** Blocks emptied by pops stay in the map and are reused by the next pushes,
+** a stack going up and down a block boundary does not allocate;
+** shrink_to_fit frees them. A deque that never held an element allocates
+** nothing.
+** Pushes and pops at the ends keep references to the other elements valid;
+** insert and erase elsewhere move the elements on the shorter side.
+*/
+
+#include <limits>
+#include <algorithm>
+#include "../utils/utils.hpp"
+#include "../utils/type_traits.hpp"
+#include "../utils/algorithm.hpp"
+#include "../utils/memory.hpp"
+#include "../utils/hardening.hpp"
+#include "../iterator/deque_iterator.hpp"
+
+namespace ft
+{
+	template<class T, class Alloc = std::allocator<T> >
+	class deque
+	{
+		public:
+			typedef T												value_type;
+			typedef Alloc											allocator_type;
+			typedef	std::size_t										size_type;
+			typedef	std::ptrdiff_t									difference_type;
+			typedef T&												reference;
+			typedef typename allocator_type::const_reference		const_reference;
+			typedef typename allocator_type::pointer				pointer;
+			typedef typename allocator_type::const_pointer			const_pointer;
+			typedef ft::deque_iterator<T>							iterator;
+			typedef	ft::deque_iterator<const T>						const_iterator;
+			typedef	ft::reverse_iterator<iterator>					reverse_iterator;
+			typedef	ft::reverse_iterator<const_iterator>			const_reverse_iterator;
+
+		private:
+			typedef pointer*												map_pointer;
+			typedef typename Alloc::template rebind<pointer>::other		map_allocator_type;
+
+			static const difference_type	block_size = deque_block_size<T>::value;
+
+			allocator_type		_allocator;
+			map_allocator_type	_map_allocator;
+			map_pointer			_map; // every slot holds a block or NULL
+			size_type			_map_size;
+			iterator			_start;
+			iterator			_finish; // its block always exists
+
+		public:
+			//default (1) ---
+			explicit deque(const allocator_type& alloc = allocator_type())
+			: _allocator(alloc)
+			, _map_allocator(alloc)
+			, _map(NULL)
+			, _map_size(0)
+			{}
+
+			//fill (2) ---
+			explicit deque(size_type n, const value_type& val = value_type(),
+					const allocator_type& alloc = allocator_type())
+			: _allocator(alloc)
+			, _map_allocator(alloc)
+			, _map(NULL)
+			, _map_size(0)
+			{
+				try
+				{
+					insert(end(), n, val);
+				}
+				catch (...)
+				{
+					release();
+					throw ;
+				}
+			}
+
+			//range (3) ---
+			template <class InputIterator>
+			deque(InputIterator first, typename ft::enable_if< !is_integral<InputIterator >::value, InputIterator>::type last,
+					const allocator_type& alloc = allocator_type())
+			: _allocator(alloc)
+			, _map_allocator(alloc)
+			, _map(NULL)
+			, _map_size(0)
+			{
+				try
+				{
+					assign(first, last);
+				}
+				catch (...)
+				{
+					release();
+					throw ;
+				}
+			}
+
+			//copy (4) ---
+			deque(const deque& rhs)
+			: _allocator(rhs._allocator)
+			, _map_allocator(rhs._map_allocator)
+			, _map(NULL)
+			, _map_size(0)
+			{
+				try
+				{
+					assign(rhs.begin(), rhs.end());
+				}
+				catch (...)
+				{
+					release();
+					throw ;
+				}
+			}
+
+#if __cplusplus >= 201103L
+			//move (5) ---
+			deque(deque&& rhs) noexcept
+			: _allocator(rhs._allocator)
+			, _map_allocator(rhs._map_allocator)
+			, _map(rhs._map)
+			, _map_size(rhs._map_size)
+			, _start(rhs._start)
+			, _finish(rhs._finish)
+			{
+				rhs._map = NULL;
+				rhs._map_size = 0;
+				rhs._start = iterator();
+				rhs._finish = iterator();
+			}
+#endif
+
+			virtual ~deque()
+			{ release(); }
+
+			deque& operator=(const deque& rhs)
+			{
+				if (&rhs != this)
+					assign(rhs.begin(), rhs.end());
+				return (*this);
+			}
+
+#if __cplusplus >= 201103L
+			deque& operator=(deque&& rhs) noexcept
+			{
+				if (&rhs != this)
+					deque(std::move(rhs)).swap(*this);
+				return (*this);
+			}
+#endif
+
+			/*
+			** ITERATORS
+			*/
+
+			iterator begin()
+			{ return (_start); }
+
+			const_iterator begin() const
+			{ return (_start); }
+
+			iterator end()
+			{ return (_finish); }
+
+			const_iterator end() const
+			{ return (_finish); }
+
+			reverse_iterator rbegin()
+			{ return (reverse_iterator(end())); }
+
+			const_reverse_iterator rbegin() const
+			{ return (const_reverse_iterator(end())); }
+
+			reverse_iterator rend()
+			{ return (reverse_iterator(begin())); }
+
+			const_reverse_iterator rend() const
+			{ return (const_reverse_iterator(begin())); }
+
+			/*
+			** CAPACITY
+			*/
+
+			size_type size() const
+			{ return (_finish - _start); }
+
+			size_type max_size() const
+			{ return (_allocator.max_size()); }
+
+			void resize(size_type n, value_type val = value_type())
+			{
+				size_type	len(size());
+
+				if (len < n)
+					insert(end(), n - len, val);
+				else
+					erase(begin() + n, end());
+			}
+
+			bool empty() const
+			{ return (_start == _finish); }
+
+			// frees the spare blocks, and everything once empty
+			void shrink_to_fit()
+			{
+				if (_map == NULL)
+					return ;
+				if (empty())
+					return (release());
+				remap(_finish.node() - _start.node() + 1, 0);
+			}
+
+			/*
+			** ELEMENT ACCESS
+			*/
+
+			// unchecked, use at() for a checked access (see FT_HARDENING)
+			reference operator[](size_type n)
+			{
+				FT_CHECK(n < size(), "deque::operator[]: index out of range");
+				return (_start[n]);
+			}
+
+			const_reference operator[](size_type n) const
+			{
+				FT_CHECK(n < size(), "deque::operator[]: index out of range");
+				return (_start[n]);
+			}
+
+			reference at(size_type n)
+			{
+				if (n >= size())
+					throw std::out_of_range("Out of range");
+				return (_start[n]);
+			}
+
+			const_reference at(size_type n) const
+			{
+				if (n >= size())
+					throw std::out_of_range("Out of range");
+				return (_start[n]);
+			}
+
+			reference front()
+			{
+				FT_CHECK(!empty(), "deque::front: empty deque");
+				return (*_start);
+			}
+
+			const_reference front() const
+			{
+				FT_CHECK(!empty(), "deque::front: empty deque");
+				return (*_start);
+			}
+
+			reference back()
+			{
+				FT_CHECK(!empty(), "deque::back: empty deque");
+				return (*(_finish - 1));
+			}
+
+			const_reference back() const
+			{
+				FT_CHECK(!empty(), "deque::back: empty deque");
+				return (*(_finish - 1));
+			}
+
+			/*
+			** MODIFIERS
+			*/
+
+			// range (1) ---
+			template<class InputIterator>
+			void assign(InputIterator first, typename ft::enable_if<!is_integral<InputIterator>::value, InputIterator>::type last)
+			{
+				iterator	it(begin());
+
+				for (; first != last && it != end(); ++first, ++it)
+					*it = *first;
+				if (first == last)
+					erase(it, end());
+				for (; first != last; ++first)
+					push_back(*first);
+			}
+
+			// fill (2) ---
+			void assign(size_type n, const value_type& val)
+			{
+				iterator	it(begin());
+
+				for (; n && it != end(); --n, ++it)
+					*it = val;
+				if (n)
+					insert(end(), n, val);
+				else
+					erase(it, end());
+			}
+
+			void push_back(const value_type& val)
+			{
+				reserve_back(1);
+				_allocator.construct(_finish.base(), val);
+				++_finish;
+			}
+
+			void push_front(const value_type& val)
+			{
+				reserve_front(1);
+				iterator	slot(_start - 1);
+				_allocator.construct(slot.base(), val);
+				_start = slot;
+			}
+
+#if __cplusplus >= 201103L
+			void push_back(value_type&& val)
+			{ emplace_back(std::move(val)); }
+
+			void push_front(value_type&& val)
+			{ emplace_front(std::move(val)); }
+
+			template<class... Args>
+			void emplace_back(Args&&... args)
+			{
+				reserve_back(1);
+				_allocator.construct(_finish.base(), std::forward<Args>(args)...);
+				++_finish;
+			}
+
+			template<class... Args>
+			void emplace_front(Args&&... args)
+			{
+				reserve_front(1);
+				iterator	slot(_start - 1);
+				_allocator.construct(slot.base(), std::forward<Args>(args)...);
+				_start = slot;
+			}
+
+			template<class... Args>
+			iterator emplace(iterator position, Args&&... args)
+			{
+				FT_CHECK(valid(position), "deque::emplace: iterator out of range");
+				difference_type	index(position - begin());
+
+				if (position == end())
+					emplace_back(std::forward<Args>(args)...);
+				else if (index == 0)
+					emplace_front(std::forward<Args>(args)...);
+				else
+				{
+					value_type	tmp(std::forward<Args>(args)...); // args may refer to an element
+					if (static_cast<size_type>(index) < size() / 2)
+					{
+						push_front(std::move(front()));
+						iterator	it(begin() + 1);
+						for (difference_type i(1); i < index; i++, ++it)
+							*it = std::move(*(it + 1));
+						*it = std::move(tmp);
+					}
+					else
+					{
+						push_back(std::move(back()));
+						iterator	it(end() - 2);
+						for (iterator pos(begin() + index); it != pos; --it)
+							*it = std::move(*(it - 1));
+						*it = std::move(tmp);
+					}
+				}
+				return (begin() + index);
+			}
+#endif
+
+			void pop_back()
+			{
+				FT_CHECK(!empty(), "deque::pop_back: empty deque");
+				--_finish;
+				_allocator.destroy(_finish.base());
+			}
+
+			void pop_front()
+			{
+				FT_CHECK(!empty(), "deque::pop_front: empty deque");
+				_allocator.destroy(_start.base());
+				++_start;
+			}
+
+			// single element(1) ---
+			iterator insert(iterator position, const value_type& val)
+			{
+				difference_type	index(position - begin());
+				insert(position, 1, val);
+				return (begin() + index);
+			}
+
+#if __cplusplus >= 201103L
+			iterator insert(iterator position, value_type&& val)
+			{ return (emplace(position, std::move(val))); }
+#endif
+
+			// fill (2) ---
+			void insert(iterator position, size_type n, const value_type& val)
+			{
+				FT_CHECK(valid(position), "deque::insert: iterator out of range");
+				if (!n)
+					return ;
+				if (n > max_size() - size())
+					throw std::length_error("deque::insert");
+				value_type		copy(val); // val may be one of the moved elements
+				difference_type	index(position - begin());
+
+				if (static_cast<size_type>(index) < size() / 2)
+				{
+					reserve_front(n);
+					for (size_type i(0); i < n; i++)
+						construct_front(copy);
+					std::rotate(begin(), begin() + n, begin() + (n + index));
+				}
+				else
+				{
+					size_type	len(size());
+					reserve_back(n);
+					for (size_type i(0); i < n; i++)
+						construct_back(copy);
+					std::rotate(begin() + index, begin() + len, end());
+				}
+			}
+
+			// range (3) ---
+			template<class InputIterator>
+			void insert(iterator position, InputIterator first,
+					typename ft::enable_if<!is_integral<InputIterator>::value, InputIterator>::type last)
+			{
+				FT_CHECK(valid(position), "deque::insert: iterator out of range");
+				insert_range(position - begin(), first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+			}
+
+			// single element (1) ---
+			iterator erase(iterator position)
+			{
+				FT_CHECK(position != end(), "deque::erase: end() is not erasable");
+				return erase(position, position + 1);
+			}
+
+			// range (2) ---
+			iterator erase(iterator first, iterator last)
+			{
+				FT_CHECK(valid(first) && valid(last) && !(last < first), "deque::erase: invalid range");
+				difference_type	n(last - first);
+				difference_type	index(first - begin());
+
+				if (!n)
+					return (first);
+				if (index < (static_cast<difference_type>(size()) - n) / 2)
+				{
+					iterator	dst(last);
+					for (iterator src(first); src != begin(); )
+						*--dst = FT_MOVE(*--src);
+					for (; n; n--)
+						pop_front();
+				}
+				else
+				{
+					iterator	dst(first);
+					for (iterator src(last); src != end(); ++src, ++dst)
+						*dst = FT_MOVE(*src);
+					for (; n; n--)
+						pop_back();
+				}
+				return (begin() + index);
+			}
+
+			void swap(deque& rhs)
+			{
+				std::swap(_allocator, rhs._allocator);
+				std::swap(_map_allocator, rhs._map_allocator);
+				std::swap(_map, rhs._map);
+				std::swap(_map_size, rhs._map_size);
+				std::swap(_start, rhs._start);
+				std::swap(_finish, rhs._finish);
+			}
+
+			// keeps the blocks
+			void clear()
+			{
+				if (!ft::is_trivially_destructible<value_type>::value)
+					for (iterator it(_start); it != _finish; ++it)
+						_allocator.destroy(it.base());
+				_finish = _start;
+			}
+
+			/*
+			** ALLOCATOR
+			*/
+
+			allocator_type get_allocator() const
+			{ return (_allocator); }
+
+		private:
+			// position is one of ours, end() included (FT_HARDENING)
+			bool valid(iterator position) const
+			{ return (!(position < _start) && !(_finish < position)); }
+
+			/*
+			** BLOCKS
+			*/
+
+			// the first block, in the middle of a small map
+			void init_map()
+			{
+				_map_size = 8;
+				_map = _map_allocator.allocate(_map_size);
+				std::fill(_map, _map + _map_size, pointer(NULL));
+				map_pointer	node(_map + _map_size / 2);
+				try
+				{
+					*node = _allocator.allocate(block_size);
+				}
+				catch (...)
+				{
+					_map_allocator.deallocate(_map, _map_size);
+					_map = NULL;
+					_map_size = 0;
+					throw ;
+				}
+				_start = iterator(*node, node);
+				_finish = _start;
+			}
+
+			map_pointer start_node() const
+			{ return (const_cast<map_pointer>(_start.node())); }
+
+			map_pointer finish_node() const
+			{ return (const_cast<map_pointer>(_finish.node())); }
+
+			// room for n more elements after the last one, whose slot must
+			// stay in a block; without a map both ends are NULL, no room
+			void reserve_back(size_type n)
+			{
+				if (static_cast<size_type>(_finish.block_end() - _finish.base()) <= n)
+					add_back_blocks(n);
+			}
+
+			// room for n more elements before the first one
+			void reserve_front(size_type n)
+			{
+				if (static_cast<size_type>(_start.base() - _start.block_begin()) < n)
+					add_front_blocks(n);
+			}
+
+			// kept out of the pushes, whose loops would lose registers to it
+			FT_NOINLINE void add_back_blocks(size_type n)
+			{
+				if (_map == NULL)
+					init_map();
+				size_type	room(_finish.block_end() - _finish.base());
+				if (room > n)
+					return ;
+				size_type	nodes((n - room) / block_size + 1);
+				if (finish_node() + nodes >= _map + _map_size)
+					grow_map(nodes, false);
+				map_pointer	node(finish_node());
+				for (size_type i(1); i <= nodes; i++)
+					if (node[i] == NULL)
+						node[i] = _allocator.allocate(block_size);
+			}
+
+			FT_NOINLINE void add_front_blocks(size_type n)
+			{
+				if (_map == NULL)
+					init_map();
+				size_type	room(_start.base() - _start.block_begin());
+				if (room >= n)
+					return ;
+				size_type	nodes((n - room + block_size - 1) / block_size);
+				if (static_cast<size_type>(start_node() - _map) < nodes)
+					grow_map(nodes, true);
+				map_pointer	node(start_node());
+				for (size_type i(1); i <= nodes; i++)
+					if (*(node - i) == NULL)
+						*(node - i) = _allocator.allocate(block_size);
+			}
+
+			// room for nodes more blocks at one end: the blocks in use are
+			// centered again, in a bigger map unless at most half of it is used
+			void grow_map(size_type nodes, bool at_front)
+			{
+				size_type	used(finish_node() - start_node() + 1 + nodes);
+				size_type	map_size(_map_size);
+
+				if (used * 2 > _map_size)
+					map_size = _map_size + std::max(_map_size, nodes) + 2;
+				remap(map_size, (map_size - used) / 2 + (at_front ? nodes : 0));
+			}
+
+			// moves the blocks in use to a map of map_size slots, the first one
+			// at offset; spare blocks fill the slots after them, then the ones
+			// before, and are freed when none is left
+			void remap(size_type map_size, size_type offset)
+			{
+				map_pointer	map(_map_allocator.allocate(map_size));
+				size_type	used(finish_node() - start_node() + 1);
+				map_pointer	front(map + offset);
+				map_pointer	back(front + used);
+
+				std::fill(map, map + map_size, pointer(NULL));
+				std::copy(start_node(), finish_node() + 1, front);
+				for (map_pointer node(_map); node != _map + _map_size; node++)
+				{
+					if (*node == NULL || (node >= start_node() && node <= finish_node()))
+						continue ;
+					if (back != map + map_size)
+						*back++ = *node;
+					else if (front != map)
+						*--front = *node;
+					else
+						_allocator.deallocate(*node, block_size);
+				}
+				_start = iterator(_start.base(), map + offset);
+				_finish = iterator(_finish.base(), map + offset + used - 1);
+				_map_allocator.deallocate(_map, _map_size);
+				_map = map;
+				_map_size = map_size;
+			}
+
+			// destroys the elements and frees every block and the map
+			void release()
+			{
+				if (_map == NULL)
+					return ;
+				clear();
+				for (size_type i(0); i < _map_size; i++)
+					if (_map[i] != NULL)
+						_allocator.deallocate(_map[i], block_size);
+				_map_allocator.deallocate(_map, _map_size);
+				_map = NULL;
+				_map_size = 0;
+				_start = iterator();
+				_finish = iterator();
+			}
+
+			/*
+			** INSERTION
+			*/
+
+			// the room was reserved
+			template<class U>
+			void construct_back(const U& val)
+			{
+				_allocator.construct(_finish.base(), val);
+				++_finish;
+			}
+
+			template<class U>
+			void construct_front(const U& val)
+			{
+				iterator	slot(_start - 1);
+				_allocator.construct(slot.base(), val);
+				_start = slot;
+			}
+
+			// single pass: appends in place, anything else goes through a
+			// temporary deque
+			template<class InputIterator>
+			void insert_range(difference_type index, InputIterator first, InputIterator last, ft::input_iterator_tag)
+			{
+				if (index == static_cast<difference_type>(size()))
+				{
+					for (; first != last; ++first)
+						push_back(*first);
+					return ;
+				}
+				deque	tmp(first, last);
+				insert_range(index, tmp.begin(), tmp.end(), ft::random_access_iterator_tag());
+			}
+
+			// the new elements are built at the nearest end, then rotated
+			// into place
+			template<class ForwardIterator>
+			void insert_range(difference_type index, ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag)
+			{
+				size_type	n(ft::distance(first, last));
+
+				if (!n)
+					return ;
+				if (n > max_size() - size())
+					throw std::length_error("deque::insert");
+				if (static_cast<size_type>(index) < size() / 2)
+				{
+					reserve_front(n);
+					iterator	front(_start - n);
+					iterator	dst(front);
+					try
+					{
+						for (; first != last; ++first, ++dst)
+							_allocator.construct(dst.base(), *first);
+					}
+					catch (...)
+					{
+						for (; front != dst; ++front)
+							_allocator.destroy(front.base());
+						throw ;
+					}
+					_start = front;
+					std::rotate(begin(), begin() + n, begin() + (n + index));
+				}
+				else
+				{
+					size_type	len(size());
+					reserve_back(n);
+					for (; first != last; ++first)
+						construct_back(*first);
+					std::rotate(begin() + index, begin() + len, end());
+				}
+			}
+	};
+
+	/*
+	** Non Member Functions
+	*/
+
+	// (1) ---
+	template <class T, class Alloc>
+	bool operator==(const deque<T, Alloc> &lhs, const deque<T, Alloc> &rhs)
+	{
+		if (lhs.size() != rhs.size())
+			return (false);
+		return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	};
+
+	// (2) ---
+	template <class T, class Alloc>
+	bool operator!=(const deque<T, Alloc> &lhs, const deque<T, Alloc> &rhs)
+	{ return (!(lhs == rhs)); };
+
+	// (3) ---
+	template <class T, class Alloc>
+	bool operator<(const deque<T,Alloc>& lhs, const deque<T,Alloc>& rhs)
+	{ return (lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end())); };
+
+	// (4) ---
+	template <class T, class Alloc>
+	bool operator<=(const deque<T,Alloc>& lhs, const deque<T,Alloc>& rhs)
+	{ return (!(rhs < lhs)); };
+
+	// (5) ---
+	template <class T, class Alloc>
+	bool operator>(const deque<T,Alloc>& lhs, const deque<T,Alloc>& rhs)
+	{ return (rhs < lhs); };
+
+	// (6) ---
+	template <class T, class Alloc>
+	bool operator>=(const deque<T,Alloc>& lhs, const deque<T,Alloc>& rhs)
+	{ return (!(lhs < rhs)); };
+
+	template <class T, class Alloc>
+	void swap(deque<T,Alloc>& x, deque<T,Alloc>& y)
+	{ x.swap(y); }
+}
@@ -16,7 +16,9 @@
 #include "../utils/utils.hpp"
 #include "../utils/RBTree.hpp"
 #include "../utils/enums.hpp"
+#include "../utils/bloom_filter.hpp"
 #include "vector.hpp"
+#include "../utils/sort.hpp"
 #include <limits>
 
 namespace ft
@@ -24,7 +26,9 @@ namespace ft
 	template <class Key,
 			class T,
 			class Compare = std::less<Key>,
-			class Alloc = std::allocator<ft::pair<const Key, T> > >
+			class Alloc = std::allocator<ft::pair<const Key, T> >,
+			class Balance = ft::rb_balance,
+			class Filter = ft::no_filter >
 	class map
 	{
 		public :
@@ -32,8 +36,11 @@ namespace ft
 			typedef T mapped_type;
 			typedef ft::pair<const key_type, mapped_type> value_type;
 			typedef ft::node<value_type> node_type;
+			typedef typename Alloc::template rebind<node_type>::other node_allocator_type;
 			typedef Compare key_compare;
 			typedef Alloc allocator_type;
+			typedef Balance balance_type;
+			typedef Filter filter_type;
 			typedef typename allocator_type::reference reference;
 			typedef typename allocator_type::const_reference const_reference;
 			typedef typename allocator_type::pointer pointer;
@@ -45,7 +52,7 @@ namespace ft
 			typedef typename ft::iterator_traits<iterator>::difference_type difference_type;
 			typedef size_t size_type;
 
-			class value_compare : public std::binary_function<value_type, value_type, bool>
+			class value_compare
 			{
 				friend class map;
 				protected :
@@ -63,7 +70,8 @@ namespace ft
 		private :
 			key_compare _comp;
 			allocator_type _alloc;
-			RBTree<value_type, key_type, Compare> _tree;
+			RBTree<value_type, key_type, Compare, node_allocator_type, Balance> _tree;
+			Filter _filter;
 
 		public :
 
@@ -71,19 +79,27 @@ namespace ft
 
 			explicit map(const key_compare &comp,
 						const allocator_type &alloc = allocator_type())
-						: _comp(comp), _alloc(alloc)
+						: _comp(comp), _alloc(alloc), _tree(comp, node_allocator_type(alloc))
 			{}
 
 			template <class InputIterator>
 			map(InputIterator first, InputIterator last,
 				const key_compare &comp = key_compare(),
 				const allocator_type &alloc = allocator_type())
-				: _comp(comp), _alloc(alloc)
+				: _comp(comp), _alloc(alloc), _tree(comp, node_allocator_type(alloc))
 			{ this->insert(first, last); }
 
 			map(const map &x)
+			: _comp(x._comp), _alloc(x._alloc), _tree(x._comp, node_allocator_type(x._alloc))
 			{ *this = x; }
 
+#if __cplusplus >= 201103L
+			// steals the nodes, x is left empty
+			map(map &&x)
+			: _comp(x._comp), _alloc(x._alloc), _tree(x._comp, node_allocator_type(x._alloc))
+			{ this->swap(x); }
+#endif
+
 			virtual ~map()
 			{}
 
@@ -93,10 +109,23 @@ namespace ft
 				{
 					this->_tree = x._tree;
 					this->_comp = x._comp;
+					this->_filter = x._filter;
 				}
 				return *this;
 			}
 
+#if __cplusplus >= 201103L
+			map& operator= (map &&x)
+			{
+				if (this != &x)
+				{
+					this->clear();
+					this->swap(x);
+				}
+				return *this;
+			}
+#endif
+
 			/*
 			** ITERATOR
 			*/
@@ -165,13 +194,26 @@ namespace ft
 				ft::node<value_type>* ptr = this->_tree.insert(val);
 				iterator it(ptr, this->_tree.root());
 				if (s != this->_tree.size())
+				{
 					to_ret.second = true;
+					this->learn(val.first);
+				}
 				else
 					to_ret.second = false;
 				to_ret.first = it;
 				return (to_ret);
 			}
 
+#if __cplusplus >= 201103L
+			template <class... Args>
+			pair<iterator, bool> emplace(Args&&... args)
+			{ return (this->insert(value_type(std::forward<Args>(args)...))); }
+
+			template <class... Args>
+			iterator emplace_hint(iterator position, Args&&... args)
+			{ return (this->insert(position, value_type(std::forward<Args>(args)...))); }
+#endif
+
 			iterator insert(iterator position, const value_type &val)
 			{
 				(void)position;
@@ -184,11 +226,61 @@ namespace ft
 			{
 				while (first != last)
 				{
-					this->_tree.insert(*first);
+					this->insert(*first);
 					first++;
 				}
 			}
 
+			// replaces the content with [first, last), which must already be
+			// sorted with no duplicate keys, in linear time; single pass
+			// input is buffered first
+			template <class InputIterator>
+			void build_sorted(InputIterator first, InputIterator last)
+			{
+				this->build_sorted(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+				this->rebuild_filter();
+			}
+
+#if __cplusplus >= 201103L
+			// replaces the content with [first, last), in any order: sorted
+			// with a parallel stable sort, deduplicated (a key seen twice
+			// keeps its first value, like insert), then built bottom-up with
+			// the subtrees built concurrently by the workers of pool
+			template <class InputIterator>
+			void build_parallel(InputIterator first, InputIterator last,
+					thread_pool &pool = thread_pool::global())
+			{
+				typedef ft::pair<key_type, mapped_type>	entry;
+
+				ft::vector<entry>	entries(first, last);
+				key_compare			comp = this->_comp;
+
+				ft::parallel_stable_sort(entries.begin(), entries.end(),
+					[comp](const entry &a, const entry &b) { return (comp(a.first, b.first)); }, pool);
+				size_t n = unique_keys(entries, pool);
+				this->_tree.build_sorted(entries.begin(), n, pool);
+				this->rebuild_filter();
+			}
+#endif
+
+			// inserts the sorted range [first, last) with finger searches, each
+			// element only walks from the previous one; keys already in the map
+			// keep their value, like insert
+			template <class InputIterator>
+			void merge_sorted(InputIterator first, InputIterator last)
+			{
+				node_type *pos = this->_tree.sentinel();
+				for (; first != last; first++)
+				{
+					pos = this->_tree.lower_bound(pos, first->first);
+					if (pos == this->_tree.sentinel() || this->_comp(first->first, pos->key_val.first))
+					{
+						pos = this->_tree.insert_before(pos, *first);
+						this->learn(first->first);
+					}
+				}
+			}
+
 			void erase(iterator position)
 			{
 				this->_tree.erase(position.base());
@@ -223,11 +315,15 @@ namespace ft
 			void swap (map& x)
 			{
 				this->_tree.swap(x._tree);
+				this->_filter.swap(x._filter);
+				std::swap(this->_alloc, x._alloc);
+				std::swap(this->_comp, x._comp);
 			}
 
 			void clear()
 			{
 				this->_tree.destroy_tree();
+				this->_filter.clear();
 			}
 
 			/*
@@ -235,26 +331,10 @@ namespace ft
 			*/
 
 			iterator find (const key_type& k)
-			{
-				iterator it = this->begin();
-				while (it != this->end() && it->first != k)
-				{
-					it++;
-				}
-				if (it->first == k)
-					return (it);
-				return this->end();
-			}
+			{ return iterator(this->filtered_find(k), this->_tree.root()); }
 
 			const_iterator find(const key_type &k) const
-			{
-				const_iterator it = this->begin();
-				while (it != this->end() && it->first != k)
-					it++;
-				if (it->first == k)
-					return (it);
-				return this->end();
-			}
+			{ return const_iterator(this->filtered_find(k), this->_tree.root()); }
 
 			size_type count(const key_type &k) const
 			{
@@ -264,51 +344,38 @@ namespace ft
 			}
 
 			iterator lower_bound(const key_type &k)
-			{
-				iterator it = this->begin();
-				while (it != this->end())
-				{
-					if (!this->_comp(it->first, k))
-						return it;
-					it++;
-				}
-				return it;
-			}
+			{ return iterator(this->_tree.lower_bound(k), this->_tree.root()); }
 
 			const_iterator lower_bound(const key_type &k) const
-			{
-				const_iterator it = this->begin();
-				while (it != this->end())
-				{
-					if (!this->_comp(it->first, k))
-						return it;
-					it++;
-				}
-				return it;
-			}
+			{ return const_iterator(this->_tree.lower_bound(k), this->_tree.root()); }
 
 			iterator upper_bound(const key_type &k)
+			{ return iterator(this->_tree.upper_bound(k), this->_tree.root()); }
+
+			const_iterator upper_bound(const key_type &k) const
+			{ return const_iterator(this->_tree.upper_bound(k), this->_tree.root()); }
+
+			/*
+			** Finger search: same results as above, in O(log d) when the bound
+			** is d elements after from (merge-joins, cursors...).
+			*/
+
+			iterator lower_bound(iterator from, const key_type &k)
+			{ return iterator(this->_tree.lower_bound(from.base(), k), this->_tree.root()); }
+
+			const_iterator lower_bound(const_iterator from, const key_type &k) const
 			{
-				iterator it = this->begin();
-				while (it != this->end())
-				{
-					if (this->_comp(k, it->first))
-						return it;
-					it++;
-				}
-				return it;
+				return const_iterator(this->_tree.lower_bound(const_cast<node_type *>(from.base()), k),
+					this->_tree.root());
 			}
 
-			const_iterator upper_bound(const key_type &k) const
+			iterator upper_bound(iterator from, const key_type &k)
+			{ return iterator(this->_tree.upper_bound(from.base(), k), this->_tree.root()); }
+
+			const_iterator upper_bound(const_iterator from, const key_type &k) const
 			{
-				const_iterator it = this->begin();
-				while (it != this->end())
-				{
-					if (this->_comp(k, it->first))
-						return it;
-					it++;
-				}
-				return it;
+				return const_iterator(this->_tree.upper_bound(const_cast<node_type *>(from.base()), k),
+					this->_tree.root());
 			}
 
 			pair<const_iterator, const_iterator> equal_range(const key_type &k) const
@@ -335,47 +402,144 @@ namespace ft
 
 			allocator_type get_allocator() const
 			{ return this->_alloc; }
+
+			/*
+			** FILTER
+			** Erased keys are never removed from the filter, rebuild it once a
+			** lot of them piled up.
+			*/
+
+			const filter_type& filter() const
+			{ return this->_filter; }
+
+			void rebuild_filter()
+			{ this->fill_filter(this->_filter); }
+
+		private :
+			// the default no_filter learns nothing: no walk over the tree
+			void fill_filter(ft::no_filter &)
+			{}
+
+			template <class AnyFilter>
+			void fill_filter(AnyFilter &filter)
+			{
+				filter.reset(this->size());
+				for (const_iterator it = this->begin(); it != this->end(); it++)
+					filter.add(it->first);
+			}
+
+			template <class InputIterator>
+			void build_sorted(InputIterator first, InputIterator last, ft::input_iterator_tag)
+			{
+				ft::vector<ft::pair<key_type, mapped_type> > entries(first, last);
+				this->_tree.build_sorted(entries.begin(), entries.size());
+			}
+
+			template <class ForwardIterator>
+			void build_sorted(ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag)
+			{ this->_tree.build_sorted(first, ft::distance(first, last)); }
+
+#if __cplusplus >= 201103L
+			// moves the first entry of every run of equal keys to the front of
+			// the sorted entries, returns how many there are; the duplicates
+			// are looked for in parallel, the compaction only runs if any
+			template <class Entry>
+			size_t unique_keys(ft::vector<Entry> &entries, thread_pool &pool) const
+			{
+				std::ptrdiff_t			n = entries.size();
+				std::ptrdiff_t			parts = static_cast<std::ptrdiff_t>(pool.size() + 1);
+				std::atomic<bool>		duplicates(false);
+				task_group				group(pool);
+
+				for (std::ptrdiff_t k = 0; k < parts; k++)
+				{
+					std::ptrdiff_t begin = (n * k / parts > 0 ? n * k / parts : 1);
+					std::ptrdiff_t end = n * (k + 1) / parts;
+					group.run([&, begin, end]() {
+						for (std::ptrdiff_t i = begin; i < end; i++)
+						{
+							if (!this->_comp(entries[i - 1].first, entries[i].first))
+							{
+								duplicates = true;
+								return ;
+							}
+						}
+					});
+				}
+				group.wait();
+				if (!duplicates)
+					return (n);
+				size_t kept = 0;
+				for (std::ptrdiff_t i = 0; i < n; i++)
+				{
+					if (kept != 0 && !this->_comp(entries[kept - 1].first, entries[i].first))
+						continue ;
+					if (static_cast<std::ptrdiff_t>(kept) != i)
+						entries[kept] = FT_MOVE(entries[i]);
+					kept++;
+				}
+				return (kept);
+			}
+#endif
+
+			void learn(const key_type &k)
+			{
+				if (this->_filter.needs_rebuild(this->size()))
+					this->rebuild_filter();
+				else
+					this->_filter.add(k);
+			}
+
+			node_type *filtered_find(const key_type &k) const
+			{
+				if (!this->_filter.may_contain(k))
+					return this->_tree.sentinel();
+				node_type *found = this->_tree.find(k);
+				if (found == this->_tree.sentinel())
+					this->_filter.false_positive();
+				return found;
+			}
 	};
 
 	/*
 	** NON MEMBER FUNCTIONS
 	*/
-	template <class Key, class T, class Compare, class Alloc>
-	bool operator==(const map<Key, T, Compare, Alloc> &lhs,
-		const map<Key, T, Compare, Alloc> &rhs)
+	template <class Key, class T, class Compare, class Alloc, class Balance, class Filter>
+	bool operator==(const map<Key, T, Compare, Alloc, Balance, Filter> &lhs,
+		const map<Key, T, Compare, Alloc, Balance, Filter> &rhs)
 		{
 			if (lhs.size() != rhs.size())
 				return (false);
 			return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
 		}
 
-	template <class Key, class T, class Compare, class Alloc>
-	bool operator!=(const map<Key, T, Compare, Alloc> &lhs,
-		const map<Key, T, Compare, Alloc> &rhs)
+	template <class Key, class T, class Compare, class Alloc, class Balance, class Filter>
+	bool operator!=(const map<Key, T, Compare, Alloc, Balance, Filter> &lhs,
+		const map<Key, T, Compare, Alloc, Balance, Filter> &rhs)
 		{ return (!(lhs == rhs)); }
 
-	template <class Key, class T, class Compare, class Alloc>
-	bool operator<(const map<Key, T, Compare, Alloc> &lhs,
-		const map<Key, T, Compare, Alloc> &rhs)
+	template <class Key, class T, class Compare, class Alloc, class Balance, class Filter>
+	bool operator<(const map<Key, T, Compare, Alloc, Balance, Filter> &lhs,
+		const map<Key, T, Compare, Alloc, Balance, Filter> &rhs)
 		{ return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()); }
 
-	template <class Key, class T, class Compare, class Alloc>
-	bool operator<=(const map<Key, T, Compare, Alloc> &lhs,
-		const map<Key, T, Compare, Alloc> &rhs)
+	template <class Key, class T, class Compare, class Alloc, class Balance, class Filter>
+	bool operator<=(const map<Key, T, Compare, Alloc, Balance, Filter> &lhs,
+		const map<Key, T, Compare, Alloc, Balance, Filter> &rhs)
 		{ return (lhs == rhs || lhs < rhs); }
 
-	template <class Key, class T, class Compare, class Alloc>
-	bool operator>(const map<Key, T, Compare, Alloc> &lhs,
-		const map<Key, T, Compare, Alloc> &rhs)
+	template <class Key, class T, class Compare, class Alloc, class Balance, class Filter>
+	bool operator>(const map<Key, T, Compare, Alloc, Balance, Filter> &lhs,
+		const map<Key, T, Compare, Alloc, Balance, Filter> &rhs)
 		{ return(rhs < lhs); }
 
-	template <class Key, class T, class Compare, class Alloc>
-	bool operator>=(const map<Key, T, Compare, Alloc> &lhs,
-		const map<Key, T, Compare, Alloc> &rhs)
+	template <class Key, class T, class Compare, class Alloc, class Balance, class Filter>
+	bool operator>=(const map<Key, T, Compare, Alloc, Balance, Filter> &lhs,
+		const map<Key, T, Compare, Alloc, Balance, Filter> &rhs)
 		{ return (lhs > rhs || lhs == rhs); }
 
-	template <class Key, class T, class Compare, class Alloc>
-	void swap(map<Key, T, Compare, Alloc> &lhs,
-		map<Key, T, Compare, Alloc> &rhs)
+	template <class Key, class T, class Compare, class Alloc, class Balance, class Filter>
+	void swap(map<Key, T, Compare, Alloc, Balance, Filter> &lhs,
+		map<Key, T, Compare, Alloc, Balance, Filter> &rhs)
 	{ lhs.swap(rhs); }
 }
\ No newline at end of file
@@ -0,0 +1,251 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   map_snapshot.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+#include <stdint.h>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "map.hpp"
+#include "../utils/type_traits.hpp"
+
+/*
+** MAP SNAPSHOT
+** Binary image of a map whose key and mapped types are trivially copyable:
+** a 64 bytes header followed by the records in key order. Loading mmaps the
+** file, so it can be searched in place or fed to map::build_sorted.
+*/
+
+namespace ft
+{
+	// Records are written and mapped back as raw bytes, so both halves
+	// must be trivially copyable; anything else fails to compile here.
+	template<class Key, class T>
+	struct snapshot_record
+	{
+		typedef char	trivially_copyable_check[(ft::is_trivially_copyable<Key>::value
+							&& ft::is_trivially_copyable<T>::value) ? 1 : -1];
+
+		Key	first;
+		T	second;
+	};
+
+	struct snapshot_header
+	{
+		char		magic[8];
+		uint32_t	version;
+		uint32_t	record_size;
+		uint64_t	count;
+		uint64_t	checksum;
+		char		padding[32]; // keeps the records cache line aligned
+	};
+
+	static const char		snapshot_magic[8] = { 'F', 'T', 'M', 'A', 'P', 'S', 'N', 'P' };
+	static const uint32_t	snapshot_version = 1;
+
+	/*
+	** FNV-1a over 8 bytes words, then over the trailing bytes. Feeding it in
+	** chunks gives the same result as long as every chunk but the last one
+	** is a multiple of 8 bytes long.
+	*/
+
+	inline uint64_t snapshot_checksum(const void *data, size_t len,
+			uint64_t hash = 14695981039346656037ULL)
+	{
+		const unsigned char	*bytes = static_cast<const unsigned char *>(data);
+		uint64_t			word;
+		size_t				i = 0;
+
+		for (; i + sizeof(word) <= len; i += sizeof(word))
+		{
+			std::memcpy(&word, bytes + i, sizeof(word));
+			hash = (hash ^ word) * 1099511628211ULL;
+		}
+		for (; i < len; i++)
+			hash = (hash ^ bytes[i]) * 1099511628211ULL;
+		return (hash);
+	}
+
+	/*
+	** WRITER
+	*/
+
+	template <class Key, class T, class Compare, class Alloc, class Balance, class Filter>
+	void write_snapshot(const map<Key, T, Compare, Alloc, Balance, Filter> &m, const char *path)
+	{
+		typedef snapshot_record<Key, T>										record_type;
+		typedef typename map<Key, T, Compare, Alloc, Balance, Filter>::const_iterator	const_iterator;
+
+		const size_t		chunk = 8192; // records, keeps chunks a multiple of 8 bytes
+		snapshot_header		header;
+		ft::vector<char>	buffer(chunk * sizeof(record_type));
+		record_type			*records = reinterpret_cast<record_type *>(&buffer[0]);
+		int					fd;
+
+		std::memset(&header, 0, sizeof(header));
+		std::memcpy(header.magic, snapshot_magic, sizeof(header.magic));
+		header.version = snapshot_version;
+		header.record_size = sizeof(record_type);
+		header.count = m.size();
+		header.checksum = snapshot_checksum(NULL, 0);
+		fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		if (fd < 0)
+			throw std::runtime_error("write_snapshot: cannot open file");
+		if (lseek(fd, sizeof(header), SEEK_SET) < 0)
+		{
+			close(fd);
+			throw std::runtime_error("write_snapshot: seek failed");
+		}
+		const_iterator it = m.begin();
+		const_iterator ite = m.end();
+		while (it != ite)
+		{
+			size_t n = 0;
+			std::memset(records, 0, chunk * sizeof(record_type)); // no garbage padding
+			for (; n < chunk && it != ite; n++, it++)
+			{
+				records[n].first = it->first;
+				records[n].second = it->second;
+			}
+			size_t len = n * sizeof(record_type);
+			header.checksum = snapshot_checksum(records, len, header.checksum);
+			if (write(fd, records, len) != static_cast<ssize_t>(len))
+			{
+				close(fd);
+				throw std::runtime_error("write_snapshot: write failed");
+			}
+		}
+		if (pwrite(fd, &header, sizeof(header), 0) != static_cast<ssize_t>(sizeof(header))
+			|| close(fd) != 0)
+			throw std::runtime_error("write_snapshot: write failed");
+	}
+
+	/*
+	** READER
+	** Read-only view of a snapshot file, valid as long as the object lives.
+	*/
+
+	template <class Key, class T, class Compare = std::less<Key> >
+	class map_snapshot
+	{
+		public:
+			typedef snapshot_record<Key, T>		value_type;
+			typedef const value_type*			const_iterator;
+			typedef size_t						size_type;
+
+			// verify re-computes the checksum, which touches every page
+			explicit map_snapshot(const char *path, bool verify = true,
+					const Compare &comp = Compare())
+			: _comp(comp), _map(NULL), _len(0), _records(NULL), _size(0)
+			{
+				struct stat			st;
+				snapshot_header		header;
+				int					fd = open(path, O_RDONLY);
+
+				if (fd < 0)
+					throw std::runtime_error("map_snapshot: cannot open file");
+				if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(header))
+				{
+					close(fd);
+					throw std::runtime_error("map_snapshot: truncated file");
+				}
+				_len = st.st_size;
+				_map = mmap(NULL, _len, PROT_READ, MAP_PRIVATE, fd, 0);
+				close(fd);
+				if (_map == MAP_FAILED)
+					throw std::runtime_error("map_snapshot: mmap failed");
+				std::memcpy(&header, _map, sizeof(header));
+				_records = reinterpret_cast<const value_type *>(static_cast<const char *>(_map) + sizeof(header));
+				_size = header.count;
+				if (std::memcmp(header.magic, snapshot_magic, sizeof(header.magic)) != 0)
+					fail("map_snapshot: not a snapshot");
+				if (header.version != snapshot_version)
+					fail("map_snapshot: unsupported version");
+				if (header.record_size != sizeof(value_type))
+					fail("map_snapshot: record size mismatch");
+				if (header.count != (_len - sizeof(header)) / sizeof(value_type)
+					|| (_len - sizeof(header)) % sizeof(value_type) != 0)
+					fail("map_snapshot: truncated file");
+				if (verify && snapshot_checksum(_records, _size * sizeof(value_type)) != header.checksum)
+					fail("map_snapshot: checksum mismatch");
+			}
+
+			~map_snapshot()
+			{ munmap(_map, _len); }
+
+			const_iterator begin() const
+			{ return (_records); }
+
+			const_iterator end() const
+			{ return (_records + _size); }
+
+			size_type size() const
+			{ return (_size); }
+
+			bool empty() const
+			{ return (_size == 0); }
+
+			const_iterator lower_bound(const Key &k) const
+			{
+				const_iterator	first = _records;
+				size_type		len = _size;
+
+				while (len > 0)
+				{
+					size_type half = len / 2;
+					if (_comp(first[half].first, k))
+					{
+						first += half + 1;
+						len -= half + 1;
+					}
+					else
+						len = half;
+				}
+				return (first);
+			}
+
+			const_iterator find(const Key &k) const
+			{
+				const_iterator it = lower_bound(k);
+				if (it != end() && !_comp(k, it->first))
+					return (it);
+				return (end());
+			}
+
+			// linear time bulk load, replaces the content of m
+			template <class Map>
+			void load(Map &m) const
+			{
+				madvise(_map, _len, MADV_SEQUENTIAL);
+				m.build_sorted(begin(), end());
+			}
+
+		private:
+			map_snapshot(const map_snapshot &);
+			map_snapshot &operator=(const map_snapshot &);
+
+			void fail(const char *what)
+			{
+				munmap(_map, _len);
+				throw std::runtime_error(what);
+			}
+
+			Compare				_comp;
+			void				*_map;
+			size_t				_len;
+			const value_type	*_records;
+			size_type			_size;
+	};
+}
@@ -0,0 +1,645 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   small_vector.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+#include <limits>
+#include "../utils/utils.hpp"
+#include "../utils/type_traits.hpp"
+#include "../utils/algorithm.hpp"
+#include "../utils/memory.hpp"
+#include "../utils/hardening.hpp"
+#include "../iterator/random_access_iterator.hpp"
+
+/*
+** SMALL VECTOR
+** A vector keeping its first N elements inside the object: short vectors
+** never touch the allocator. Past N the elements move to the heap and it
+** grows like ft::vector. Iterators are invalidated by the move to the heap
+** and, unlike ft::vector, by swapping or moving a vector that is still
+** inline.
+*/
+
+namespace ft
+{
+	template<class T, size_t N = 8, class Alloc = std::allocator<T> >
+	class small_vector
+	{
+		public:
+			typedef T												value_type;
+			typedef Alloc											allocator_type;
+			typedef	std::size_t										size_type;
+			typedef	std::ptrdiff_t									difference_type;
+			typedef T&												reference;
+			typedef typename allocator_type::const_reference		const_reference;
+			typedef typename allocator_type::pointer				pointer;
+			typedef typename allocator_type::const_pointer			const_pointer;
+			typedef ft::random_access_iterator<T>					iterator;
+			typedef	ft::random_access_iterator<const T>				const_iterator;
+			typedef	ft::reverse_iterator<iterator>					reverse_iterator;
+			typedef	ft::reverse_iterator<const_iterator>			const_reverse_iterator;
+
+			static const size_type	inline_capacity = N;
+
+		private:
+			typedef char	inline_capacity_check[N > 0 ? 1 : -1];
+
+			// raw inline slots, the other members only align them
+			union storage
+			{
+#if __cplusplus >= 201103L
+				alignas(T) char	bytes[N * sizeof(T)];
+#else
+				char		bytes[N * sizeof(T)];
+#endif
+				long double	align_ld;
+				long long	align_ll;
+				void		*align_p;
+			};
+
+			allocator_type	_allocator;
+			pointer			_base;
+			size_type		_capacity;
+			size_type		_size;
+			storage			_inline;
+
+		public:
+			//default (1) ---
+			explicit small_vector(const allocator_type& alloc = allocator_type())
+			: _allocator(alloc)
+			, _base(inline_data())
+			, _capacity(N)
+			, _size(0)
+			{}
+
+			//fill (2) ---
+			explicit small_vector(size_type n, const value_type& val = value_type(),
+					const allocator_type& alloc = allocator_type())
+			: _allocator(alloc)
+			, _base(inline_data())
+			, _capacity(N)
+			, _size(0)
+			{ insert(end(), n, val); }
+
+			//range (3) ---
+			template <class InputIterator>
+			small_vector(InputIterator first, typename ft::enable_if< !is_integral<InputIterator >::value, InputIterator>::type last,
+					const allocator_type& alloc = allocator_type())
+			: _allocator(alloc)
+			, _base(inline_data())
+			, _capacity(N)
+			, _size(0)
+			{ insert(end(), first, last); }
+
+			//copy (4) ---
+			small_vector(const small_vector& rhs)
+			: _allocator(rhs._allocator)
+			, _base(inline_data())
+			, _capacity(N)
+			, _size(0)
+			{ insert(end(), rhs.begin(), rhs.end()); }
+
+#if __cplusplus >= 201103L
+			//move (5) ---
+			small_vector(small_vector&& rhs)
+			: _allocator(rhs._allocator)
+			, _base(inline_data())
+			, _capacity(N)
+			, _size(0)
+			{ steal(rhs); }
+#endif
+
+			~small_vector()
+			{
+				clear();
+				if (!is_inline())
+					_allocator.deallocate(_base, _capacity);
+			}
+
+			small_vector& operator=(const small_vector& rhs)
+			{
+				if (&rhs != this)
+					assign(rhs.begin(), rhs.end());
+				return (*this);
+			}
+
+#if __cplusplus >= 201103L
+			small_vector& operator=(small_vector&& rhs)
+			{
+				if (&rhs != this)
+				{
+					clear();
+					if (!is_inline())
+						_allocator.deallocate(_base, _capacity);
+					_base = inline_data();
+					_capacity = N;
+					// a stolen block is freed by the allocator it came from
+					_allocator = rhs._allocator;
+					steal(rhs);
+				}
+				return (*this);
+			}
+#endif
+
+			/*
+			** ITERATORS
+			*/
+
+			iterator begin()
+			{ return (iterator(_base)); }
+
+			const_iterator begin() const
+			{ return (const_iterator(_base)); }
+
+			iterator end()
+			{ return (iterator(_base + _size)); }
+
+			const_iterator end() const
+			{ return (const_iterator(_base + _size)); }
+
+			reverse_iterator rbegin()
+			{ return (reverse_iterator(end())); }
+
+			const_reverse_iterator rbegin() const
+			{ return (const_reverse_iterator(end())); }
+
+			reverse_iterator rend()
+			{ return (reverse_iterator(begin())); }
+
+			const_reverse_iterator rend() const
+			{ return (const_reverse_iterator(begin())); }
+
+			/*
+			** CAPACITY
+			*/
+
+			size_type size() const
+			{ return (_size); }
+
+			size_type max_size() const
+			{ return (_allocator.max_size()); }
+
+			void resize(size_type n, value_type val = value_type())
+			{
+				if (_size < n)
+					insert(end(), n - _size, val);
+				else
+				{
+					ft::destroy_range(_base + n, _base + _size, _allocator);
+					_size = n;
+				}
+			}
+
+			size_type capacity() const
+			{ return (_capacity); }
+
+			bool empty() const
+			{ return (_size == 0); }
+
+			// true while the elements still live inside the object
+			bool is_inline() const
+			{ return (_base == inline_data()); }
+
+			void reserve(size_type n)
+			{
+				if (n > max_size())
+					throw std::length_error("small_vector::reserve");
+				if (_capacity < n)
+					grow(n);
+			}
+
+			/*
+			** ELEMENT ACCESS
+			*/
+
+			reference operator[](size_type n)
+			{
+				FT_CHECK(n < _size, "small_vector::operator[]: index out of range");
+				return (_base[n]);
+			}
+
+			const_reference operator[](size_type n) const
+			{
+				FT_CHECK(n < _size, "small_vector::operator[]: index out of range");
+				return (_base[n]);
+			}
+
+			reference at(size_type n)
+			{
+				if (n >= _size)
+					throw std::out_of_range("Out of range");
+				return (_base[n]);
+			}
+
+			const_reference at(size_type n) const
+			{
+				if (n >= _size)
+					throw std::out_of_range("Out of range");
+				return (_base[n]);
+			}
+
+			reference front()
+			{
+				FT_CHECK(_size, "small_vector::front: empty vector");
+				return (_base[0]);
+			}
+
+			const_reference front() const
+			{
+				FT_CHECK(_size, "small_vector::front: empty vector");
+				return (_base[0]);
+			}
+
+			reference back()
+			{
+				FT_CHECK(_size, "small_vector::back: empty vector");
+				return (_base[_size - 1]);
+			}
+
+			const_reference back() const
+			{
+				FT_CHECK(_size, "small_vector::back: empty vector");
+				return (_base[_size - 1]);
+			}
+
+			/*
+			** MODIFIERS
+			*/
+
+			// range (1) ---
+			template<class InputIterator>
+			void assign(InputIterator first, typename ft::enable_if<!is_integral<InputIterator>::value, InputIterator>::type last)
+			{
+				clear();
+				insert(end(), first, last);
+			}
+
+			// fill (2) ---
+			void assign(size_type n, const value_type& val)
+			{
+				value_type	copy(val); // val may be one of ours
+				clear();
+				insert(end(), n, copy);
+			}
+
+			void push_back(const value_type& val)
+			{
+				if (_size == _capacity)
+				{
+					value_type	copy(val); // val may be one of the relocated elements
+					grow(recommend(1));
+					_allocator.construct(_base + _size, copy);
+				}
+				else
+					_allocator.construct(_base + _size, val);
+				_size++;
+			}
+
+#if __cplusplus >= 201103L
+			void push_back(value_type&& val)
+			{ emplace_back(std::move(val)); }
+
+			template<class... Args>
+			void emplace_back(Args&&... args)
+			{
+				if (_size == _capacity)
+				{
+					value_type	tmp(std::forward<Args>(args)...);
+					grow(recommend(1));
+					_allocator.construct(_base + _size, std::move(tmp));
+				}
+				else
+					_allocator.construct(_base + _size, std::forward<Args>(args)...);
+				_size++;
+			}
+#endif
+
+			void pop_back()
+			{
+				FT_CHECK(_size, "small_vector::pop_back: empty vector");
+				_size--;
+				_allocator.destroy(_base + _size);
+			}
+
+			// single element(1) ---
+			iterator insert(iterator position, const value_type& val)
+			{
+				size_type idx = position - begin();
+				insert(position, 1, val);
+				return (begin() + idx);
+			}
+
+			// fill (2) ---
+			void insert(iterator position, size_type n, const value_type& val)
+			{
+				FT_CHECK(valid(position), "small_vector::insert: iterator out of range");
+				size_type	start(position - begin());
+
+				if (!n)
+					return ;
+				if (n > max_size() - _size)
+					throw std::length_error("small_vector::insert");
+				value_type	copy(val); // val may be one of the shifted elements
+				if (_size + n > _capacity)
+					grow(recommend(n));
+				open_gap(start, n);
+				try
+				{
+					ft::uninitialized_fill_n(_base + start, n, copy, _allocator);
+				}
+				catch (...)
+				{
+					drop_gap(start, n, 0);
+					throw ;
+				}
+				_size += n;
+			}
+
+			// range (3) ---
+			template<class InputIterator>
+			void insert(iterator position, InputIterator first,
+					typename ft::enable_if<!is_integral<InputIterator>::value, InputIterator>::type last)
+			{
+				FT_CHECK(valid(position), "small_vector::insert: iterator out of range");
+				insert_range(position - begin(), first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+			}
+
+			// single element (1) ---
+			iterator erase(iterator position)
+			{
+				FT_CHECK(position != end(), "small_vector::erase: end() is not erasable");
+				return erase(position, position + 1);
+			}
+
+			// range (2) ---
+			iterator erase(iterator first, iterator last)
+			{
+				FT_CHECK(valid(first) && valid(last) && !(last < first), "small_vector::erase: invalid range");
+				size_type	start(first - begin());
+				size_type	n(last - first);
+
+				if (!n)
+					return (first);
+				ft::destroy_range(_base + start, _base + start + n, _allocator);
+				close_gap(start, n);
+				_size -= n;
+				return (begin() + start);
+			}
+
+			// pointers are swapped when both vectors are on the heap, inline
+			// elements are relocated
+			void swap(small_vector& rhs)
+			{
+				if (&rhs == this)
+					return ;
+				if (!is_inline() && !rhs.is_inline())
+				{
+					std::swap(_base, rhs._base);
+					std::swap(_capacity, rhs._capacity);
+					std::swap(_size, rhs._size);
+				}
+				else if (is_inline() && rhs.is_inline())
+				{
+					storage		tmp;
+					pointer		tmp_base(reinterpret_cast<pointer>(tmp.bytes));
+					size_type	tmp_size(_size);
+
+					ft::uninitialized_relocate(tmp_base, _base, _size, _allocator);
+					ft::uninitialized_relocate(_base, rhs._base, rhs._size, _allocator);
+					ft::uninitialized_relocate(rhs._base, tmp_base, tmp_size, _allocator);
+					_size = rhs._size;
+					rhs._size = tmp_size;
+				}
+				else if (is_inline())
+					rhs.give_heap(*this);
+				else
+					give_heap(rhs);
+				std::swap(_allocator, rhs._allocator);
+			}
+
+			void clear()
+			{
+				ft::destroy_range(_base, _base + _size, _allocator);
+				_size = 0;
+			}
+
+			/*
+			** ALLOCATOR
+			*/
+
+			allocator_type get_allocator() const
+			{ return (_allocator); }
+
+		private:
+			// position is one of ours, end() included (FT_HARDENING)
+			bool valid(iterator position) const
+			{ return (position.base() >= _base && position.base() <= _base + _size); }
+
+			pointer inline_data()
+			{ return (reinterpret_cast<pointer>(_inline.bytes)); }
+
+			const_pointer inline_data() const
+			{ return (reinterpret_cast<const_pointer>(_inline.bytes)); }
+
+			size_type recommend(size_type n) const
+			{
+				if (_size + n > _size * 2)
+					return (_size + n);
+				return (_size * 2);
+			}
+
+			// moves the elements to a heap block of n slots
+			void grow(size_type n)
+			{
+				pointer	mem(_allocator.allocate(n));
+
+				try
+				{
+					ft::uninitialized_relocate(mem, _base, _size, _allocator);
+				}
+				catch (...)
+				{
+					_allocator.deallocate(mem, n);
+					throw ;
+				}
+				if (!is_inline())
+					_allocator.deallocate(_base, _capacity);
+				_base = mem;
+				_capacity = n;
+			}
+
+			// this is on the heap and small is inline: small takes the heap
+			// block, this takes small's elements inline
+			void give_heap(small_vector& small)
+			{
+				pointer		mem(_base);
+				size_type	capacity(_capacity);
+				size_type	size(_size);
+
+				_base = inline_data();
+				_capacity = N;
+				ft::uninitialized_relocate(_base, small._base, small._size, _allocator);
+				_size = small._size;
+				small._base = mem;
+				small._capacity = capacity;
+				small._size = size;
+			}
+
+			// this is empty and inline: takes rhs's elements, rhs is left empty
+			void steal(small_vector& rhs)
+			{
+				if (rhs.is_inline())
+				{
+					ft::uninitialized_relocate(_base, rhs._base, rhs._size, _allocator);
+					_size = rhs._size;
+				}
+				else
+				{
+					_base = rhs._base;
+					_capacity = rhs._capacity;
+					_size = rhs._size;
+					rhs._base = rhs.inline_data();
+					rhs._capacity = N;
+				}
+				rhs._size = 0;
+			}
+
+			// relocates [start, _size) n slots up, the gap is left raw
+			void open_gap(size_type start, size_type n)
+			{
+				if (ft::is_trivially_relocatable<value_type>::value)
+				{
+					std::memmove(static_cast<void *>(_base + start + n), static_cast<const void *>(_base + start),
+						(_size - start) * sizeof(value_type));
+					return ;
+				}
+				size_type	i(_size);
+				try
+				{
+					for (; i > start; i--)
+					{
+						_allocator.construct(_base + i - 1 + n, FT_MOVE_IF_NOEXCEPT(_base[i - 1]));
+						_allocator.destroy(_base + i - 1);
+					}
+				}
+				catch (...)
+				{
+					// only [0, i) is still in place
+					ft::destroy_range(_base + i + n, _base + _size + n, _allocator);
+					_size = i;
+					throw ;
+				}
+			}
+
+			// filling the gap threw after built elements: keeps [0, start)
+			void drop_gap(size_type start, size_type n, size_type built)
+			{
+				ft::destroy_range(_base + start, _base + start + built, _allocator);
+				ft::destroy_range(_base + start + n, _base + _size + n, _allocator);
+				_size = start;
+			}
+
+			// relocates [start + n, _size) n slots down over a raw gap
+			void close_gap(size_type start, size_type n)
+			{
+				if (ft::is_trivially_relocatable<value_type>::value)
+				{
+					std::memmove(static_cast<void *>(_base + start), static_cast<const void *>(_base + start + n),
+						(_size - start - n) * sizeof(value_type));
+					return ;
+				}
+				for (size_type i(start + n); i < _size; i++)
+				{
+					_allocator.construct(_base + i - n, FT_MOVE_IF_NOEXCEPT(_base[i]));
+					_allocator.destroy(_base + i);
+				}
+			}
+
+			template<class InputIterator>
+			void insert_range(size_type start, InputIterator first, InputIterator last, ft::input_iterator_tag)
+			{
+				if (start == _size)
+				{
+					for (; first != last; ++first)
+						push_back(*first);
+					return ;
+				}
+				small_vector	tmp(first, last);
+				insert_range(start, tmp.begin(), tmp.end(), ft::random_access_iterator_tag());
+			}
+
+			template<class ForwardIterator>
+			void insert_range(size_type start, ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag)
+			{
+				size_type	n(ft::distance(first, last));
+
+				if (!n)
+					return ;
+				if (n > max_size() - _size)
+					throw std::length_error("small_vector::insert");
+				if (_size + n > _capacity)
+					grow(recommend(n));
+				open_gap(start, n);
+				size_type	i(0);
+				try
+				{
+					for (; i < n; i++, ++first)
+						_allocator.construct(_base + start + i, *first);
+				}
+				catch (...)
+				{
+					drop_gap(start, n, i);
+					throw ;
+				}
+				_size += n;
+			}
+	};
+
+	template<class T, size_t N, class Alloc>
+	const typename small_vector<T, N, Alloc>::size_type	small_vector<T, N, Alloc>::inline_capacity;
+
+	/*
+	** Non Member Functions
+	*/
+
+	template <class T, size_t N, class Alloc>
+	bool operator==(const small_vector<T, N, Alloc> &lhs, const small_vector<T, N, Alloc> &rhs)
+	{
+		if (lhs.size() != rhs.size())
+			return (false);
+		return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	}
+
+	template <class T, size_t N, class Alloc>
+	bool operator!=(const small_vector<T, N, Alloc> &lhs, const small_vector<T, N, Alloc> &rhs)
+	{ return (!(lhs == rhs)); }
+
+	template <class T, size_t N, class Alloc>
+	bool operator<(const small_vector<T, N, Alloc> &lhs, const small_vector<T, N, Alloc> &rhs)
+	{ return (lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end())); }
+
+	template <class T, size_t N, class Alloc>
+	bool operator<=(const small_vector<T, N, Alloc> &lhs, const small_vector<T, N, Alloc> &rhs)
+	{ return (!(rhs < lhs)); }
+
+	template <class T, size_t N, class Alloc>
+	bool operator>(const small_vector<T, N, Alloc> &lhs, const small_vector<T, N, Alloc> &rhs)
+	{ return (rhs < lhs); }
+
+	template <class T, size_t N, class Alloc>
+	bool operator>=(const small_vector<T, N, Alloc> &lhs, const small_vector<T, N, Alloc> &rhs)
+	{ return (!(lhs < rhs)); }
+
+	template <class T, size_t N, class Alloc>
+	void swap(small_vector<T, N, Alloc>& x, small_vector<T, N, Alloc>& y)
+	{ x.swap(y); }
+}
@@ -0,0 +1,407 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stable_vector.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+#include <new>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "../utils/utils.hpp"
+#include "../utils/type_traits.hpp"
+#include "../utils/algorithm.hpp"
+#include "../utils/memory.hpp"
+#include "../utils/hardening.hpp"
+#include "../iterator/random_access_iterator.hpp"
+
+/*
+** STABLE VECTOR
+** A vector over a range of address space reserved once with
+** mmap(PROT_NONE). Growing only makes more of it readable and writable
+** with mprotect, so elements never move: pointers, references and
+** iterators stay valid until the element is removed, and there is no
+** copy and no transient 3x footprint on growth. Pages only count in the
+** RSS once written. The reservation is the hard limit on the size; a
+** vector growing with nothing reserved reserves default_reservation bytes.
+** There is no insert, erase or assign in the middle, and no ordering
+** operators: only == and !=.
+*/
+
+namespace ft
+{
+	template<class T>
+	class stable_vector
+	{
+		public:
+			typedef T												value_type;
+			typedef	std::size_t										size_type;
+			typedef	std::ptrdiff_t									difference_type;
+			typedef T&												reference;
+			typedef const T&										const_reference;
+			typedef T*												pointer;
+			typedef const T*										const_pointer;
+			typedef ft::random_access_iterator<T>					iterator;
+			typedef	ft::random_access_iterator<const T>				const_iterator;
+			typedef	ft::reverse_iterator<iterator>					reverse_iterator;
+			typedef	ft::reverse_iterator<const_iterator>			const_reverse_iterator;
+
+		private:
+			pointer		_base;
+			size_type	_reserved; // bytes of address space
+			size_type	_committed; // bytes readable and writable
+			size_type	_size;
+
+		public:
+			// address space reserved on the first growth when none was asked
+			// for; it costs no memory, only room in the address space
+			static const size_type	default_reservation = static_cast<size_type>(1) << 30;
+
+			// nothing is reserved until the first growth
+			stable_vector()
+			: _base(NULL)
+			, _reserved(0)
+			, _committed(0)
+			, _size(0)
+			{}
+
+			explicit stable_vector(size_type max_elements)
+			: _base(NULL)
+			, _reserved(0)
+			, _committed(0)
+			, _size(0)
+			{ reserve_address_space(max_elements); }
+
+			stable_vector(const stable_vector& rhs)
+			: _base(NULL)
+			, _reserved(0)
+			, _committed(0)
+			, _size(0)
+			{
+				try
+				{
+					if (rhs._reserved)
+						reserve_address_space(rhs.max_size());
+					reserve(rhs._size);
+					for (size_type i(0); i < rhs._size; i++)
+						push_back(rhs._base[i]);
+				}
+				catch (...)
+				{
+					release();
+					throw ;
+				}
+			}
+
+#if __cplusplus >= 201103L
+			stable_vector(stable_vector&& rhs) noexcept
+			: _base(rhs._base)
+			, _reserved(rhs._reserved)
+			, _committed(rhs._committed)
+			, _size(rhs._size)
+			{
+				rhs._base = NULL;
+				rhs._reserved = 0;
+				rhs._committed = 0;
+				rhs._size = 0;
+			}
+#endif
+
+			~stable_vector()
+			{ release(); }
+
+			stable_vector& operator=(const stable_vector& rhs)
+			{
+				if (&rhs != this)
+					stable_vector(rhs).swap(*this);
+				return (*this);
+			}
+
+#if __cplusplus >= 201103L
+			stable_vector& operator=(stable_vector&& rhs) noexcept
+			{
+				if (&rhs != this)
+					stable_vector(std::move(rhs)).swap(*this);
+				return (*this);
+			}
+#endif
+
+			// (re)reserves room for max_elements, only while empty
+			void reserve_address_space(size_type max_elements)
+			{
+				if (_size)
+					throw std::logic_error("stable_vector::reserve_address_space: not empty");
+				if (max_elements > (std::numeric_limits<size_type>::max() - page()) / sizeof(value_type))
+					throw std::length_error("stable_vector::reserve_address_space");
+				release();
+				size_type bytes = round_up(max_elements * sizeof(value_type));
+				if (!bytes)
+					return ;
+				void *mem = mmap(NULL, bytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+				if (mem == MAP_FAILED)
+					throw std::bad_alloc();
+				_base = static_cast<pointer>(mem);
+				_reserved = bytes;
+			}
+
+			/*
+			** ITERATORS
+			*/
+
+			iterator begin()
+			{ return (iterator(_base)); }
+
+			const_iterator begin() const
+			{ return (const_iterator(_base)); }
+
+			iterator end()
+			{ return (iterator(_base + _size)); }
+
+			const_iterator end() const
+			{ return (const_iterator(_base + _size)); }
+
+			reverse_iterator rbegin()
+			{ return (reverse_iterator(end())); }
+
+			const_reverse_iterator rbegin() const
+			{ return (const_reverse_iterator(end())); }
+
+			reverse_iterator rend()
+			{ return (reverse_iterator(begin())); }
+
+			const_reverse_iterator rend() const
+			{ return (const_reverse_iterator(begin())); }
+
+			/*
+			** CAPACITY
+			*/
+
+			size_type size() const
+			{ return (_size); }
+
+			// what the reservation can hold, or the default one will
+			size_type max_size() const
+			{
+				if (_reserved)
+					return (_reserved / sizeof(value_type));
+				return (default_reservation / sizeof(value_type));
+			}
+
+			size_type capacity() const
+			{ return (_committed / sizeof(value_type)); }
+
+			bool empty() const
+			{ return (_size == 0); }
+
+			void resize(size_type n, value_type val = value_type())
+			{
+				if (n > _size)
+				{
+					size_type i(_size);
+
+					reserve(n);
+					try
+					{
+						for (; i < n; i++)
+							::new (static_cast<void *>(_base + i)) value_type(val);
+					}
+					catch (...)
+					{
+						destroy(_size, i);
+						throw ;
+					}
+				}
+				else
+					destroy(n, _size);
+				_size = n;
+			}
+
+			void reserve(size_type n)
+			{
+				if (n > max_size())
+					throw std::length_error("stable_vector::reserve: address space exhausted");
+				if (n && !_reserved)
+					reserve_address_space(max_size());
+				if (n * sizeof(value_type) > _committed)
+					commit(n * sizeof(value_type));
+			}
+
+			// gives the pages past the last element back to the system, the
+			// addresses stay reserved
+			void shrink_to_fit()
+			{
+				size_type keep = round_up(_size * sizeof(value_type));
+				if (keep >= _committed)
+					return ;
+				char *from = reinterpret_cast<char *>(_base) + keep;
+				madvise(from, _committed - keep, MADV_DONTNEED);
+				mprotect(from, _committed - keep, PROT_NONE);
+				_committed = keep;
+			}
+
+			/*
+			** ELEMENT ACCESS
+			*/
+
+			reference operator[](size_type n)
+			{
+				FT_CHECK(n < _size, "stable_vector::operator[]: index out of range");
+				return (_base[n]);
+			}
+
+			const_reference operator[](size_type n) const
+			{
+				FT_CHECK(n < _size, "stable_vector::operator[]: index out of range");
+				return (_base[n]);
+			}
+
+			reference at(size_type n)
+			{
+				if (n >= _size)
+					throw std::out_of_range("Out of range");
+				return (_base[n]);
+			}
+
+			const_reference at(size_type n) const
+			{
+				if (n >= _size)
+					throw std::out_of_range("Out of range");
+				return (_base[n]);
+			}
+
+			reference front()
+			{
+				FT_CHECK(_size, "stable_vector::front: empty vector");
+				return (_base[0]);
+			}
+
+			const_reference front() const
+			{
+				FT_CHECK(_size, "stable_vector::front: empty vector");
+				return (_base[0]);
+			}
+
+			reference back()
+			{
+				FT_CHECK(_size, "stable_vector::back: empty vector");
+				return (_base[_size - 1]);
+			}
+
+			const_reference back() const
+			{
+				FT_CHECK(_size, "stable_vector::back: empty vector");
+				return (_base[_size - 1]);
+			}
+
+			/*
+			** MODIFIERS
+			*/
+
+			// val may be one of ours: it never moves
+			void push_back(const value_type& val)
+			{
+				if ((_size + 1) * sizeof(value_type) > _committed)
+					reserve(_size + 1);
+				::new (static_cast<void *>(_base + _size)) value_type(val);
+				_size++;
+			}
+
+#if __cplusplus >= 201103L
+			template<class... Args>
+			void emplace_back(Args&&... args)
+			{
+				if ((_size + 1) * sizeof(value_type) > _committed)
+					reserve(_size + 1);
+				::new (static_cast<void *>(_base + _size)) value_type(std::forward<Args>(args)...);
+				_size++;
+			}
+#endif
+
+			void pop_back()
+			{
+				FT_CHECK(_size, "stable_vector::pop_back: empty vector");
+				_size--;
+				_base[_size].~value_type();
+			}
+
+			void clear()
+			{
+				destroy(0, _size);
+				_size = 0;
+			}
+
+			void swap(stable_vector& rhs)
+			{
+				std::swap(_base, rhs._base);
+				std::swap(_reserved, rhs._reserved);
+				std::swap(_committed, rhs._committed);
+				std::swap(_size, rhs._size);
+			}
+
+		private:
+			static size_type page()
+			{
+				static const size_type size = sysconf(_SC_PAGESIZE);
+				return (size);
+			}
+
+			static size_type round_up(size_type bytes)
+			{ return ((bytes + page() - 1) / page() * page()); }
+
+			// makes at least the first bytes usable, doubling what is already
+			// committed so a run of push_back costs a logarithmic number of calls
+			void commit(size_type bytes)
+			{
+				size_type target = round_up(bytes);
+				if (target < _committed * 2)
+					target = _committed * 2;
+				if (target > _reserved)
+					target = _reserved;
+				if (mprotect(reinterpret_cast<char *>(_base) + _committed, target - _committed,
+						PROT_READ | PROT_WRITE) != 0)
+					throw std::bad_alloc();
+				_committed = target;
+			}
+
+			void destroy(size_type from, size_type to)
+			{
+				if (ft::is_trivially_destructible<value_type>::value)
+					return ;
+				for (; from < to; from++)
+					_base[from].~value_type();
+			}
+
+			void release()
+			{
+				clear();
+				if (_base != NULL)
+					munmap(_base, _reserved);
+				_base = NULL;
+				_reserved = 0;
+				_committed = 0;
+			}
+	};
+
+	template <class T>
+	bool operator==(const stable_vector<T> &lhs, const stable_vector<T> &rhs)
+	{
+		if (lhs.size() != rhs.size())
+			return (false);
+		return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	}
+
+	template <class T>
+	bool operator!=(const stable_vector<T> &lhs, const stable_vector<T> &rhs)
+	{ return (!(lhs == rhs)); }
+
+	template <class T>
+	void swap(stable_vector<T>& x, stable_vector<T>& y)
+	{ x.swap(y); }
+}
@@ -13,10 +13,11 @@
 #pragma once
 
 #include "vector.hpp"
+#include "deque.hpp"
 
 namespace ft
 {
-	template <class T, class Container = ft::vector<T> >
+	template <class T, class Container = ft::deque<T> >
 	class stack
 	{
 		public:
@@ -35,6 +36,16 @@ namespace ft
 			: c(other.c)
 			{}
 
+#if __cplusplus >= 201103L
+			explicit stack(Container&& ctnr)
+			: c(std::move(ctnr))
+			{}
+
+			stack(stack&& other)
+			: c(std::move(other.c))
+			{}
+#endif
+
 			virtual ~stack()
 			{}
 
@@ -44,6 +55,14 @@ namespace ft
 				return (*this);
 			}
 
+#if __cplusplus >= 201103L
+			stack& operator=(stack&& rhs)
+			{
+				c = std::move(rhs.c);
+				return (*this);
+			}
+#endif
+
 			/*
 			** ELEMENT ACCESS
 			*/
@@ -61,6 +80,15 @@ namespace ft
 			void push (const value_type& val)
 			{ c.push_back(val); }
 
+#if __cplusplus >= 201103L
+			void push (value_type&& val)
+			{ c.push_back(std::move(val)); }
+
+			template <class... Args>
+			void emplace(Args&&... args)
+			{ c.emplace_back(std::forward<Args>(args)...); }
+#endif
+
 			void pop()
 			{ c.pop_back(); }
 
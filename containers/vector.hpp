@@ -16,6 +16,8 @@
 #include "../utils/utils.hpp"
 #include "../utils/type_traits.hpp"
 #include "../utils/algorithm.hpp"
+#include "../utils/memory.hpp"
+#include "../utils/hardening.hpp"
 #include "../iterator/random_access_iterator.hpp"
 
 namespace ft
@@ -78,6 +80,20 @@ namespace ft
 			, _size(0)
 			{ *this = rhs; }
 
+#if __cplusplus >= 201103L
+			//move (5) ---
+			vector(vector&& rhs) noexcept
+			: _allocator(rhs._allocator)
+			, _base(rhs._base)
+			, _capacity(rhs._capacity)
+			, _size(rhs._size)
+			{
+				rhs._base = NULL;
+				rhs._capacity = 0;
+				rhs._size = 0;
+			}
+#endif
+
 			virtual ~vector()
 			{
 				clear();
@@ -89,27 +105,45 @@ namespace ft
 			{
 				if (&rhs != this)
 				{
+					// storage goes back to the allocator it came from
+					if (_allocator != rhs._allocator)
+					{
+						clear();
+						if (_capacity > 0 && _base != NULL)
+							_allocator.deallocate(_base, _capacity);
+						_base = NULL;
+						_capacity = 0;
+					}
 					_allocator = rhs._allocator;
 					assign(rhs.begin(), rhs.end());
 				}
 				return (*this);
 			}
 
+#if __cplusplus >= 201103L
+			vector& operator=(vector&& rhs) noexcept
+			{
+				if (&rhs != this)
+					vector(std::move(rhs)).swap(*this);
+				return (*this);
+			}
+#endif
+
 			/*
 			** ITERATORS
 			*/
 
 			iterator begin()
-			{ return (iterator(_base[0])); }
+			{ return (iterator(_base)); }
 
 			const_iterator begin() const
-			{ return (const_iterator(_base[0])); }
+			{ return (const_iterator(_base)); }
 
 			iterator end()
-			{ return (iterator(_base[_size])); }
+			{ return (iterator(_base + _size)); }
 
 			const_iterator end() const
-			{ return (const_iterator(_base[_size])); }
+			{ return (const_iterator(_base + _size)); }
 
 			reverse_iterator rbegin()
 			{ return (reverse_iterator(end())); }
@@ -136,16 +170,28 @@ namespace ft
 			void resize(size_type n, value_type val = value_type())
 			{
 				if (_size < n)
-				{
 					insert(end(), n - _size, val);
-				}
 				else
-				{
-					while (_size > n)
-						erase(end() - 1);
-				}
+					shrink(n);
+			}
+
+			// like resize, but new trivial elements are left uninitialized,
+			// for buffers that are about to be overwritten
+			void resize(size_type n, ft::default_init_t)
+			{
+				if (_size >= n)
+					return (shrink(n));
+				if (n > max_size())
+					throw std::length_error("vector::resize");
+				if (n > _capacity)
+					reserve(recommend(n - _size));
+				ft::uninitialized_default_n(_base + _size, n - _size, _allocator);
+				_size = n;
 			}
 
+			void resize_uninitialized(size_type n)
+			{ resize(n, ft::default_init); }
+
 			size_type capacity() const
 			{ return (_capacity); }
 
@@ -157,31 +203,32 @@ namespace ft
 				if (n > max_size())
 					throw std::length_error("vector::reserve");
 				if (_capacity < n)
-				{
-					pointer old_mem = _base;
-					_base = _allocator.allocate(n);
-					if (_capacity)
-					{
-						for (size_type i = 0; i < _size; i++)
-						{
-							_allocator.construct(_base + i, old_mem[i]);
-							_allocator.destroy(old_mem + i);
-						}
-					}
-					_allocator.deallocate(old_mem, _capacity);
-					_capacity = n;
-				}
+					move_to(n);
+			}
+
+			// drops the unused capacity
+			void shrink_to_fit()
+			{
+				if (_capacity > _size)
+					move_to(_size);
 			}
 
 			/*
 			** ELEMENT ACCESS
 			*/
 
+			// unchecked, use at() for a checked access (see FT_HARDENING)
 			reference operator[](size_type n)
-			{ return (at(n)); }
+			{
+				FT_CHECK(n < _size, "vector::operator[]: index out of range");
+				return (_base[n]);
+			}
 
 			const_reference operator[](size_type n) const
-			{ return (at(n)); }
+			{
+				FT_CHECK(n < _size, "vector::operator[]: index out of range");
+				return (_base[n]);
+			}
 
 			reference at(size_type n)
 			{
@@ -198,16 +245,28 @@ namespace ft
 			}
 
 			reference front()
-			{ return (_base[0]); }
+			{
+				FT_CHECK(_size, "vector::front: empty vector");
+				return (_base[0]);
+			}
  
 			const_reference front() const
-			{ return (_base[0]); }
+			{
+				FT_CHECK(_size, "vector::front: empty vector");
+				return (_base[0]);
+			}
 
 			reference back()
-			{ return (_base[_size - 1]); }
+			{
+				FT_CHECK(_size, "vector::back: empty vector");
+				return (_base[_size - 1]);
+			}
 
 			const_reference back() const
-			{ return (_base[_size - 1]); }
+			{
+				FT_CHECK(_size, "vector::back: empty vector");
+				return (_base[_size - 1]);
+			}
 
 			/*
 			** MODIFIERS
@@ -216,15 +275,7 @@ namespace ft
 			// range (1) ---
 			template<class InputIterator>
 			void assign(InputIterator first, typename ft::enable_if<!is_integral<InputIterator>::value, InputIterator>::type last)
-			{
-				InputIterator	tmp = first;
-				size_type		len = 0;
-				while (tmp++ != last)
-					len++;
-				resize(len);
-				for(int i = 0; first != last; i++, first++)
-					_base[i] = *first;
-			}
+			{ assign_range(first, last, typename ft::iterator_traits<InputIterator>::iterator_category()); }
 			
 			// fill (2) ---
 			void assign(size_type n, const value_type& val)
@@ -238,10 +289,54 @@ namespace ft
 			}
 
 			void push_back(const value_type& val)
-			{ insert(end(), val); }
+			{
+				if (_size == _capacity)
+					return (realloc_insert(_size, 1, val));
+				_allocator.construct(_base + _size, val);
+				_size++;
+			}
+
+#if __cplusplus >= 201103L
+			void push_back(value_type&& val)
+			{ emplace_back(std::move(val)); }
+
+			template<class... Args>
+			void emplace_back(Args&&... args)
+			{
+				if (_size == _capacity)
+					return (realloc_emplace(_size, std::forward<Args>(args)...));
+				_allocator.construct(_base + _size, std::forward<Args>(args)...);
+				_size++;
+			}
+
+			template<class... Args>
+			iterator emplace(iterator position, Args&&... args)
+			{
+				FT_CHECK(valid(position), "vector::emplace: iterator out of range");
+				size_type	start(position - begin());
+
+				if (start == _size)
+					emplace_back(std::forward<Args>(args)...);
+				else if (_size == _capacity)
+					realloc_emplace(start, std::forward<Args>(args)...);
+				else
+				{
+					value_type	tmp(std::forward<Args>(args)...); // args may refer to an element
+					_allocator.construct(_base + _size, std::move(_base[_size - 1]));
+					for (size_type i(_size - 1); i > start; i--)
+						_base[i] = std::move(_base[i - 1]);
+					_base[start] = std::move(tmp);
+					_size++;
+				}
+				return (begin() + start);
+			}
+#endif
 
 			void pop_back()
-			{ erase(end() - 1); }
+			{
+				FT_CHECK(_size, "vector::pop_back: empty vector");
+				erase(end() - 1);
+			}
 
 			// single element(1) ---
 			iterator insert(iterator position, const value_type& val)
@@ -251,38 +346,48 @@ namespace ft
 				return (begin() + idx);
 			}
 
+#if __cplusplus >= 201103L
+			iterator insert(iterator position, value_type&& val)
+			{ return (emplace(position, std::move(val))); }
+#endif
+
 			// fill (2) ---
 			void insert(iterator position, size_type n, const value_type& val)
 			{
-				difference_type	start(position - begin());
-				size_type		len(_size - start);
-				pointer			tmp(NULL);
+				FT_CHECK(valid(position), "vector::insert: iterator out of range");
+				size_type	start(position - begin());
+				size_type	after(_size - start);
+				pointer		pos(_base + start);
 
 				if (!n || n > max_size())
 					return ;
-				tmp = _allocator.allocate(len);
-				if (!_capacity)
-					reserve(_size + n);
-				else if (_size + n > _size * 2)
-					reserve(_size + n);
-				else if (_size + n > _capacity)
-					reserve(_size * 2);
-				for (size_type i(start); i < _size; i++)
+				if (_size + n > _capacity)
+					return (realloc_insert(start, n, val));
+				value_type	copy(val); // val may be one of the shifted elements
+				if (ft::is_trivially_copyable<value_type>::value)
 				{
-					_allocator.construct(tmp + (i - start), _base[i]);
-					_allocator.destroy(_base + i);
+					std::memmove(static_cast<void *>(pos + n), static_cast<const void *>(pos), after * sizeof(value_type));
+					ft::uninitialized_fill_n(pos, n, copy, _allocator);
 				}
-				for (size_type i(0); i < n; i++)
+				else if (after > n)
 				{
-					_allocator.construct(_base + (i + start), val);
-					_size++;
+					for (size_type i(0); i < n; i++)
+						_allocator.construct(_base + _size + i, FT_MOVE(_base[_size - n + i]));
+					for (size_type i(after - n); i > 0; i--)
+						pos[i - 1 + n] = FT_MOVE(pos[i - 1]);
+					for (size_type i(0); i < n; i++)
+						pos[i] = copy;
 				}
-				for (size_type i(0); i < len; i++)
+				else
 				{
-					_allocator.construct(_base + (i + start + n), tmp[i]);
-					_allocator.destroy(tmp + i);
+					for (size_type i(0); i < n - after; i++)
+						_allocator.construct(_base + _size + i, copy);
+					for (size_type i(0); i < after; i++)
+						_allocator.construct(_base + start + n + i, FT_MOVE(pos[i]));
+					for (size_type i(0); i < after; i++)
+						pos[i] = copy;
 				}
-				_allocator.deallocate(tmp, len);
+				_size += n;
 			}
 
 			// range (3) ---
@@ -290,55 +395,37 @@ namespace ft
 			void insert(iterator position, InputIterator first,
 					typename ft::enable_if<!is_integral<InputIterator>::value, InputIterator>::type last)
 			{
-				difference_type	start(position - begin());
-				size_type		len(_size - start);
-				pointer			tmp(NULL);
-				size_type		n(0);
-
-				for (; last != first; last--)
-					n++;
-				if (!n || n > max_size())
-					return ;
-				tmp = _allocator.allocate(len);
-				if (!_capacity)
-					reserve(_size + n);
-				else if (_size + n > _size * 2)
-					reserve(_size + n);
-				else if (_size + n > _capacity)
-					reserve(_size * 2);
-				for (size_type i(start); i < _size; i++)
-				{
-					_allocator.construct(tmp + (i - start), _base[i]);
-					_allocator.destroy(_base + i);
-				}
-				for (size_type i(0); i < n; i++)
-				{
-					_allocator.construct(_base + (i + start), *first);
-					first++;
-					_size++;
-				}
-				for (size_type i(0); i < len; i++)
-				{
-					_allocator.construct(_base + (i + start + n), tmp[i]);
-					_allocator.destroy(tmp + i);
-				}
-				_allocator.deallocate(tmp, len);
+				FT_CHECK(valid(position), "vector::insert: iterator out of range");
+				insert_range(position - begin(), first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
 			}
 
 			// single element (1) ---
 			iterator erase(iterator position)
-			{ return erase(position, position + 1); }
+			{
+				FT_CHECK(position != end(), "vector::erase: end() is not erasable");
+				return erase(position, position + 1);
+			}
 			
 			// range (2) ---
 			iterator erase(iterator first, iterator last)
 			{
+				FT_CHECK(valid(first) && valid(last) && !(last < first), "vector::erase: invalid range");
+				if (first == last)
+					return (first);
 				difference_type size = last - first;
 				difference_type index = first - begin();
 				difference_type it = index;
-				int i = _size - (size + index);
+				size_type tail = _size - static_cast<size_type>(size + index);
 
-				for (; i; i--, first++, index++)
-					_base[index] = _base[index + size];
+				if (ft::is_trivially_copyable<value_type>::value)
+				{
+					std::memmove(static_cast<void *>(_base + index), static_cast<const void *>(_base + index + size),
+						tail * sizeof(value_type));
+					_size -= size;
+					return iterator(_base + it);
+				}
+				for (; tail; tail--, first++, index++)
+					_base[index] = FT_MOVE(_base[index + size]);
 				for (; size; _size--, size--)
 					_allocator.destroy(_base + (_size - 1));
 				return iterator(_base + it);
@@ -372,6 +459,289 @@ namespace ft
 			allocator_type get_allocator() const
 			{ return (_allocator); }
 
+		private:
+			// position is one of ours, end() included (FT_HARDENING)
+			bool valid(iterator position) const
+			{ return (position.base() >= _base && position.base() <= _base + _size); }
+
+			// the allocator can resize the block in place of a copy
+			static bool remappable()
+			{
+				return (ft::allocator_can_reallocate<allocator_type>::value
+					&& ft::is_trivially_relocatable<value_type>::value);
+			}
+
+			// moves the elements to a block of n slots
+			void move_to(size_type n)
+			{ move_to(n, ft::integral_constant<bool, ft::allocator_can_reallocate<allocator_type>::value
+				&& ft::is_trivially_relocatable<value_type>::value>()); }
+
+			void move_to(size_type n, ft::true_type)
+			{
+				_base = _allocator.reallocate(_base, _capacity, n);
+				_capacity = n;
+			}
+
+			// the vector is untouched if a copy throws
+			void move_to(size_type n, ft::false_type)
+			{
+				pointer mem = (n ? _allocator.allocate(n) : NULL);
+
+				try
+				{
+					ft::uninitialized_relocate(mem, _base, _size, _allocator);
+				}
+				catch (...)
+				{
+					if (mem != NULL)
+						_allocator.deallocate(mem, n);
+					throw ;
+				}
+				if (_base != NULL)
+					_allocator.deallocate(_base, _capacity);
+				_base = mem;
+				_capacity = n;
+			}
+
+			void shrink(size_type n)
+			{
+				ft::destroy_range(_base + n, _base + _size, _allocator);
+				_size = n;
+			}
+
+			// single pass: assigns over the current elements, then appends
+			template<class InputIterator>
+			void assign_range(InputIterator first, InputIterator last, ft::input_iterator_tag)
+			{
+				size_type	i(0);
+
+				for (; first != last && i < _size; ++first, ++i)
+					_base[i] = *first;
+				if (first == last)
+					erase(begin() + i, end());
+				for (; first != last; ++first)
+					push_back(*first);
+			}
+
+			template<class ForwardIterator>
+			void assign_range(ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag)
+			{
+				size_type	n(ft::distance(first, last));
+
+				if (n > _capacity)
+				{
+					if (n > max_size())
+						throw std::length_error("vector::assign");
+					pointer		mem(_allocator.allocate(n));
+					size_type	built(0);
+					try
+					{
+						for (; built < n; built++, ++first)
+							_allocator.construct(mem + built, *first);
+					}
+					catch (...)
+					{
+						discard(mem, n, 0, built);
+						throw ;
+					}
+					ft::destroy_range(_base, _base + _size, _allocator);
+					if (_base != NULL)
+						_allocator.deallocate(_base, _capacity);
+					_base = mem;
+					_capacity = n;
+					_size = n;
+					return ;
+				}
+				size_type	i(0);
+				for (; i < n && i < _size; i++, ++first)
+					_base[i] = *first;
+				for (; i < n; i++, ++first, _size++)
+					_allocator.construct(_base + i, *first);
+				ft::destroy_range(_base + n, _base + _size, _allocator);
+				_size = n;
+			}
+
+			// single pass: appends in place, anything else goes through a
+			// temporary so the tail is only shifted once
+			template<class InputIterator>
+			void insert_range(size_type start, InputIterator first, InputIterator last, ft::input_iterator_tag)
+			{
+				if (start == _size)
+				{
+					for (; first != last; ++first)
+						push_back(*first);
+					return ;
+				}
+				vector	tmp(first, last);
+				insert_range(start, tmp.begin(), tmp.end(), ft::random_access_iterator_tag());
+			}
+
+			template<class ForwardIterator>
+			void insert_range(size_type start, ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag)
+			{
+				size_type	after(_size - start);
+				pointer		pos(_base + start);
+				size_type	n(ft::distance(first, last));
+
+				if (!n || n > max_size())
+					return ;
+				if (_size + n > _capacity)
+					return (realloc_insert_range(start, n, first));
+				if (after > n)
+				{
+					for (size_type i(0); i < n; i++)
+						_allocator.construct(_base + _size + i, FT_MOVE(_base[_size - n + i]));
+					for (size_type i(after - n); i > 0; i--)
+						pos[i - 1 + n] = FT_MOVE(pos[i - 1]);
+					for (size_type i(0); i < n; i++, first++)
+						pos[i] = *first;
+				}
+				else
+				{
+					ForwardIterator	mid(first);
+					for (size_type i(0); i < after; i++)
+						mid++;
+					for (size_type i(0); i < n - after; i++, mid++)
+						_allocator.construct(_base + _size + i, *mid);
+					for (size_type i(0); i < after; i++)
+						_allocator.construct(_base + start + n + i, FT_MOVE(pos[i]));
+					for (size_type i(0); i < after; i++, first++)
+						pos[i] = *first;
+				}
+				_size += n;
+			}
+
+			// capacity needed to add n elements: at least double, like std::vector
+			size_type recommend(size_type n) const
+			{
+				if (_size + n > _size * 2)
+					return (_size + n);
+				return (_size * 2);
+			}
+
+			// the storage is full: build the result in a new block, the new
+			// elements first as val may live in the old one
+			void realloc_insert(size_type start, size_type n, const value_type& val)
+			{
+				size_type	capacity(recommend(n));
+
+				if (start == _size && remappable())
+				{
+					value_type	copy(val);
+					move_to(capacity);
+					ft::uninitialized_fill_n(_base + _size, n, copy, _allocator);
+					_size += n;
+					return ;
+				}
+				pointer		mem(_allocator.allocate(capacity));
+
+				try
+				{
+					ft::uninitialized_fill_n(mem + start, n, val, _allocator);
+				}
+				catch (...)
+				{
+					discard(mem, capacity, start, start);
+					throw ;
+				}
+				relocate(mem, capacity, start, n);
+			}
+
+#if __cplusplus >= 201103L
+			template<class... Args>
+			void realloc_emplace(size_type start, Args&&... args)
+			{
+				size_type	capacity(recommend(1));
+
+				if (start == _size && remappable())
+				{
+					value_type	tmp(std::forward<Args>(args)...);
+					move_to(capacity);
+					_allocator.construct(_base + _size, std::move(tmp));
+					_size++;
+					return ;
+				}
+				pointer		mem(_allocator.allocate(capacity));
+
+				try
+				{
+					_allocator.construct(mem + start, std::forward<Args>(args)...);
+				}
+				catch (...)
+				{
+					discard(mem, capacity, start, start);
+					throw ;
+				}
+				relocate(mem, capacity, start, 1);
+			}
+#endif
+
+			template<class InputIterator>
+			void realloc_insert_range(size_type start, size_type n, InputIterator first)
+			{
+				size_type	capacity(recommend(n));
+				pointer		mem(_allocator.allocate(capacity));
+				size_type	i(0);
+
+				try
+				{
+					for (; i < n; i++, first++)
+						_allocator.construct(mem + start + i, *first);
+				}
+				catch (...)
+				{
+					discard(mem, capacity, start, start + i);
+					throw ;
+				}
+				relocate(mem, capacity, start, n);
+			}
+
+			// moves the old elements around the n new ones built at
+			// mem + start and adopts mem; if a copy throws the vector is
+			// untouched and mem freed with the new elements
+			void relocate(pointer mem, size_type capacity, size_type start, size_type n)
+			{
+				if (ft::is_trivially_relocatable<value_type>::value)
+				{
+					ft::uninitialized_relocate(mem, _base, start, _allocator);
+					ft::uninitialized_relocate(mem + start + n, _base + start, _size - start, _allocator);
+				}
+				else
+				{
+					try
+					{
+						ft::uninitialized_move_n(mem, _base, start, _allocator);
+					}
+					catch (...)
+					{
+						discard(mem, capacity, start, start + n);
+						throw ;
+					}
+					try
+					{
+						ft::uninitialized_move_n(mem + start + n, _base + start, _size - start, _allocator);
+					}
+					catch (...)
+					{
+						discard(mem, capacity, 0, start + n);
+						throw ;
+					}
+					ft::destroy_range(_base, _base + _size, _allocator);
+				}
+				if (_base != NULL)
+					_allocator.deallocate(_base, _capacity);
+				_base = mem;
+				_capacity = capacity;
+				_size += n;
+			}
+
+			// frees a block that was never adopted, built from first to last
+			void discard(pointer mem, size_type capacity, size_type first, size_type last)
+			{
+				ft::destroy_range(mem + first, mem + last, _allocator);
+				_allocator.deallocate(mem, capacity);
+			}
+
 	};
 
 	/*
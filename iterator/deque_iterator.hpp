@@ -0,0 +1,231 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   deque_iterator.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+#include "iterator.hpp"
+#include "../utils/type_traits.hpp"
+
+/*
+** DEQUE ITERATOR
+** A position in a deque's blocks: the element, the bounds of its block and
+** the block's slot in the map, so stepping only looks at the map when it
+** crosses into the next block.
+*/
+
+namespace ft
+{
+	// elements per block: 4KB worth, at least 16
+	template<class T>
+	struct deque_block_size
+	{ static const std::ptrdiff_t value = (sizeof(T) < 256 ? 4096 / sizeof(T) : 16); };
+
+	template<class T>
+	class deque_iterator : public ft::iterator<random_access_iterator_tag, T>
+	{
+		public:
+			typedef T										value_type;
+			typedef std::ptrdiff_t							difference_type;
+			typedef typename ft::random_access_iterator_tag	iterator_category;
+			typedef T*										pointer;
+			typedef T&										reference;
+			typedef typename ft::remove_const<T>::type* const*	map_pointer;
+
+			/*
+			** All iterator Categories Requirements
+			*/
+
+			deque_iterator()
+			: _cur(NULL), _first(NULL), _last(NULL), _node(NULL) {}
+
+			deque_iterator(pointer cur, map_pointer node)
+			: _cur(cur), _first(*node), _last(*node + block_size), _node(node) {}
+
+			deque_iterator(pointer cur, pointer first, pointer last, map_pointer node)
+			: _cur(cur), _first(first), _last(last), _node(node) {}
+
+			deque_iterator(const deque_iterator &rhs)
+			: _cur(rhs._cur), _first(rhs._first), _last(rhs._last), _node(rhs._node) {}
+
+			operator deque_iterator<const T>() const
+			{ return (deque_iterator<const T>(_cur, _first, _last, _node)); }
+
+			deque_iterator &operator=(const deque_iterator &rhs)
+			{
+				_cur = rhs._cur;
+				_first = rhs._first;
+				_last = rhs._last;
+				_node = rhs._node;
+				return (*this);
+			}
+
+			~deque_iterator() {}
+
+			pointer base() const
+			{ return (_cur); }
+
+			map_pointer node() const
+			{ return (_node); }
+
+			deque_iterator &operator++()
+			{
+				if (++_cur == _last)
+				{
+					set_node(_node + 1);
+					_cur = _first;
+				}
+				return (*this);
+			}
+
+			deque_iterator operator++(int)
+			{
+				deque_iterator tmp(*this);
+				++*this;
+				return (tmp);
+			}
+
+			/*
+			** Forward iterator Requirements
+			*/
+
+			reference operator*() const
+			{ return (*_cur); }
+
+			pointer operator->() const
+			{ return (_cur); }
+
+			/*
+			** Bidirectional iterator Requirements
+			*/
+
+			deque_iterator &operator--()
+			{
+				if (_cur == _first)
+				{
+					set_node(_node - 1);
+					_cur = _last;
+				}
+				--_cur;
+				return (*this);
+			}
+
+			deque_iterator operator--(int)
+			{
+				deque_iterator tmp(*this);
+				--*this;
+				return (tmp);
+			}
+
+			/*
+			** Random Access iterator Requirements
+			*/
+
+			deque_iterator &operator+=(difference_type n)
+			{
+				difference_type offset = n + (_cur - _first);
+
+				if (offset >= 0 && offset < block_size)
+					_cur += n;
+				else
+				{
+					difference_type nodes = (offset > 0 ? offset / block_size
+						: -((-offset - 1) / block_size) - 1);
+					set_node(_node + nodes);
+					_cur = _first + (offset - nodes * block_size);
+				}
+				return (*this);
+			}
+
+			deque_iterator &operator-=(difference_type n)
+			{ return (*this += -n); }
+
+			deque_iterator operator+(difference_type n) const
+			{
+				deque_iterator tmp(*this);
+				return (tmp += n);
+			}
+
+			deque_iterator operator-(difference_type n) const
+			{
+				deque_iterator tmp(*this);
+				return (tmp -= n);
+			}
+
+			reference operator[](difference_type n) const
+			{ return (*(*this + n)); }
+
+			// the iterators of an empty deque have no block
+			template<class U>
+			difference_type operator-(const deque_iterator<U> &rhs) const
+			{
+				return (block_size * (_node - rhs.node() - (_node != NULL))
+					+ (_cur - _first) + (rhs.block_end() - rhs.base()));
+			}
+
+			pointer block_begin() const
+			{ return (_first); }
+
+			pointer block_end() const
+			{ return (_last); }
+
+		private:
+			static const difference_type	block_size = deque_block_size<T>::value;
+
+			pointer		_cur;
+			pointer		_first;
+			pointer		_last;
+			map_pointer	_node;
+
+			void set_node(map_pointer node)
+			{
+				_node = node;
+				_first = *node;
+				_last = _first + block_size;
+			}
+	};
+
+	/*
+	** NON MEMBER FUNCTIONS OF DEQUE ITERATOR
+	*/
+
+	template <typename IteratorL, typename IteratorR>
+	bool operator==(const deque_iterator<IteratorL> &lhs, const deque_iterator<IteratorR> &rhs)
+	{ return (lhs.base() == rhs.base()); }
+
+	template <typename IteratorL, typename IteratorR>
+	bool operator!=(const deque_iterator<IteratorL> &lhs, const deque_iterator<IteratorR> &rhs)
+	{ return (lhs.base() != rhs.base()); }
+
+	template <typename IteratorL, typename IteratorR>
+	bool operator<(const deque_iterator<IteratorL> &lhs, const deque_iterator<IteratorR> &rhs)
+	{
+		if (lhs.node() == rhs.node())
+			return (lhs.base() < rhs.base());
+		return (lhs.node() < rhs.node());
+	}
+
+	template <typename IteratorL, typename IteratorR>
+	bool operator>(const deque_iterator<IteratorL> &lhs, const deque_iterator<IteratorR> &rhs)
+	{ return (rhs < lhs); }
+
+	template <typename IteratorL, typename IteratorR>
+	bool operator<=(const deque_iterator<IteratorL> &lhs, const deque_iterator<IteratorR> &rhs)
+	{ return (!(rhs < lhs)); }
+
+	template <typename IteratorL, typename IteratorR>
+	bool operator>=(const deque_iterator<IteratorL> &lhs, const deque_iterator<IteratorR> &rhs)
+	{ return (!(lhs < rhs)); }
+
+	template<class T>
+	deque_iterator<T> operator+(typename deque_iterator<T>::difference_type n, const deque_iterator<T> &it)
+	{ return (it + n); }
+}
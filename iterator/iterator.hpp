@@ -13,6 +13,7 @@
 #pragma once
 
 #include <iostream>
+#include <iterator>
 #include "../utils/utils.hpp"
 #include "../utils/type_traits.hpp"
 #include "reverse_iterator.hpp"
@@ -22,18 +23,19 @@ namespace ft
 
 	/*
 	** ITERATOR TAGS
-	** Empty types used to differenciate the iterators
+	** Empty types used to differenciate the iterators. They are the std
+	** ones, so ft and std iterators dispatch the same way in both libraries.
 	*/
 
-	struct input_iterator_tag {};
+	typedef std::input_iterator_tag				input_iterator_tag;
 
-	struct output_iterator_tag {};
+	typedef std::output_iterator_tag			output_iterator_tag;
 
-	struct forward_iterator_tag : public input_iterator_tag {};
+	typedef std::forward_iterator_tag			forward_iterator_tag;
 
-	struct bidirectional_iterator_tag : public forward_iterator_tag {};
+	typedef std::bidirectional_iterator_tag		bidirectional_iterator_tag;
 
-	struct random_access_iterator_tag : public bidirectional_iterator_tag {};
+	typedef std::random_access_iterator_tag		random_access_iterator_tag;
 
 	/*
 	** ITERATOR TRAITS
@@ -57,11 +59,12 @@ namespace ft
 	template <class Iterator>
 	class iterator_traits<Iterator*>
 	{
-		typedef Iterator								value_type;
-		typedef std::ptrdiff_t							difference_type;
-		typedef random_access_iterator_tag				iterator_category;
-		typedef Iterator*								pointer;
-		typedef Iterator&								reference;
+		public:
+			typedef Iterator								value_type;
+			typedef std::ptrdiff_t							difference_type;
+			typedef random_access_iterator_tag				iterator_category;
+			typedef Iterator*								pointer;
+			typedef Iterator&								reference;
 	};
 
 	/*
@@ -71,13 +74,39 @@ namespace ft
 	template <class Iterator>
 	class iterator_traits<const Iterator*>
 	{
-		typedef Iterator								value_type;
-		typedef std::ptrdiff_t							difference_type;
-		typedef random_access_iterator_tag				iterator_category;
-		typedef const Iterator*							pointer;
-		typedef const Iterator&							reference;
+		public:
+			typedef Iterator								value_type;
+			typedef std::ptrdiff_t							difference_type;
+			typedef random_access_iterator_tag				iterator_category;
+			typedef const Iterator*							pointer;
+			typedef const Iterator&							reference;
 	};
 
+	/*
+	** DISTANCE
+	** Constant time for random access iterators, one pass otherwise.
+	*/
+
+	template <class InputIterator>
+	typename iterator_traits<InputIterator>::difference_type
+	distance(InputIterator first, InputIterator last, input_iterator_tag)
+	{
+		typename iterator_traits<InputIterator>::difference_type n = 0;
+		for (; first != last; ++first)
+			n++;
+		return (n);
+	}
+
+	template <class RandomAccessIterator>
+	typename iterator_traits<RandomAccessIterator>::difference_type
+	distance(RandomAccessIterator first, RandomAccessIterator last, random_access_iterator_tag)
+	{ return (last - first); }
+
+	template <class InputIterator>
+	typename iterator_traits<InputIterator>::difference_type
+	distance(InputIterator first, InputIterator last)
+	{ return (ft::distance(first, last, typename iterator_traits<InputIterator>::iterator_category())); }
+
 	/*
 	** ITERATOR
 	*/
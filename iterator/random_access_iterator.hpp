@@ -108,7 +108,7 @@ namespace ft
 			** Random Access iterator Requirements
 			*/
 
-			random_access_iterator operator+(difference_type n)
+			random_access_iterator operator+(difference_type n) const
 			{ return (random_access_iterator(_current + n)); }
 
 			random_access_iterator operator-(difference_type n) const
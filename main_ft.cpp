@@ -15,13 +15,21 @@
 
 #include "utils/utils.hpp"
 #include "containers/vector.hpp"
+#include "containers/deque.hpp"
 #include "containers/stack.hpp"
 #include "containers/map.hpp"
+#include "utils/sort.hpp"
 #include <vector>
+#include <deque>
 #include <stack>
 #include <map>
 #include <cstdio>
 #include <iomanip>
+#include <iterator>
+#include <sstream>
+#include <list>
+#include <algorithm>
+#include <functional>
 
 template<typename T>
 void vector_status(ft::vector<T> &v)
@@ -39,6 +47,46 @@ void vector_status(ft::vector<T> &v)
 	COUT_NC("-----------------" << std::endl);
 }
 
+// a string whose copies throw once the countdown reaches 0
+struct fragile
+{
+	static int	countdown;
+	std::string	s;
+
+	fragile(const std::string &str) : s(str) {}
+	fragile(const fragile &rhs) : s(rhs.s)
+	{
+		if (countdown == 0)
+			throw std::runtime_error("fragile copy");
+		countdown--;
+	}
+	fragile &operator=(const fragile &rhs)
+	{
+		s = rhs.s;
+		return (*this);
+	}
+};
+
+int	fragile::countdown = -1;
+
+std::ostream &operator<<(std::ostream &os, const fragile &f)
+{ return (os << f.s); }
+
+template<typename T>
+void deque_status(const ft::deque<T> &d)
+{
+	typename ft::deque<T>::const_iterator it = d.begin();
+	COUT_NC("-----------------");
+	COUT_NC("STATUS");
+	COUT_NC("-----------------");
+	COUT_NC("size=" << d.size() << " empty=" << d.empty());
+	COUT_NC("content:");
+	for (size_t i = 0; it != d.end(); it++, i++)
+		if (d.size() < 40 || i % 97 == 0 || i + 1 == d.size())
+			COUT_NC("[" << i << "] - " << *it);
+	COUT_NC("-----------------" << std::endl);
+}
+
 template<typename T, typename T2>
 void map_status(ft::map<T, T2> &m)
 {
@@ -170,6 +218,177 @@ void	vector_tests()
 	COUT_NC("numbers2");
 	vector_status(numbers2);
 
+	COUT_NC("ASSIGN --- INPUT ITERATORS");
+	std::istringstream in("10 20 30 40 50 60 70");
+	numbers.assign(std::istream_iterator<int>(in), std::istream_iterator<int>());
+	vector_status(numbers);
+
+	COUT_NC("ASSIGN --- FORWARD ITERATORS");
+	std::list<int> lst;
+	for (int i = 0; i < 12; i++)
+		lst.push_back(i * 3);
+	numbers.assign(lst.begin(), lst.end());
+	vector_status(numbers);
+
+	COUT_NC("ASSIGN --- RANDOM ACCESS ITERATORS");
+	int tab[] = { 7, 6, 5, 4 };
+	numbers.assign(tab, tab + 4);
+	vector_status(numbers);
+
+	COUT_NC("INSERT --- INPUT ITERATORS AT THE END");
+	std::istringstream in2("1 2 3 4 5 6 7 8 9");
+	numbers.insert(numbers.end(), std::istream_iterator<int>(in2), std::istream_iterator<int>());
+	vector_status(numbers);
+
+	COUT_NC("INSERT --- INPUT ITERATORS IN THE MIDDLE");
+	std::istringstream in3("-1 -2 -3");
+	numbers.insert(numbers.begin() + 2, std::istream_iterator<int>(in3), std::istream_iterator<int>());
+	vector_status(numbers);
+
+	COUT_NC("INSERT --- FORWARD ITERATORS");
+	numbers.insert(numbers.begin() + 1, lst.begin(), lst.end());
+	vector_status(numbers);
+
+	COUT_NC("DISTANCE");
+	COUT_NC(std::distance(numbers.begin(), numbers.end()) << " " << ft::distance(tab, tab + 4));
+
+	COUT_NC("GROWTH --- THROWING COPY");
+	ft::vector<fragile> frag;
+	for (int i = 0; i < 4; i++)
+		frag.push_back(fragile(std::string(20, 'a' + i)));
+	fragile::countdown = 2;
+	try
+	{
+		frag.push_back(fragile("pushed"));
+	}
+	catch (std::runtime_error &e)
+	{
+		COUT_NC("caught " << e.what());
+	}
+	vector_status(frag);
+	fragile::countdown = 1;
+	try
+	{
+		frag.reserve(100);
+	}
+	catch (std::runtime_error &e)
+	{
+		COUT_NC("caught " << e.what());
+	}
+	fragile::countdown = -1;
+	vector_status(frag);
+
+#if __cplusplus >= 201103L
+	COUT_NC("SHRINK_TO_FIT");
+	numbers.reserve(100);
+	numbers.erase(numbers.begin() + 5, numbers.end());
+	vector_status(numbers);
+	numbers.shrink_to_fit();
+	vector_status(numbers);
+	numbers.push_back(99);
+	vector_status(numbers);
+	numbers.clear();
+	numbers.shrink_to_fit();
+	vector_status(numbers);
+#endif
+}
+
+void	deque_tests()
+{
+	COUT_NC("-------------------------------------------- DEQUE --------------------------------------------");
+	COUT_NC("CONSTRUCTOR --- DEFAULT / FILL");
+	ft::deque<int> d;
+	deque_status(d);
+	ft::deque<int> filled(5, 42);
+	deque_status(filled);
+
+	COUT_NC("PUSH_BACK / PUSH_FRONT --- ACROSS BLOCKS");
+	for (int i = 0; i < 3000; i++)
+	{
+		d.push_back(i);
+		d.push_front(-i);
+	}
+	deque_status(d);
+	COUT_NC("front=" << d.front() << " back=" << d.back() << " [2999]=" << d[2999] << " at(5000)=" << d.at(5000));
+
+	COUT_NC("POP_BACK / POP_FRONT");
+	for (int i = 0; i < 1500; i++)
+	{
+		d.pop_back();
+		d.pop_front();
+	}
+	deque_status(d);
+
+	COUT_NC("ITERATORS --- ARITHMETIC");
+	ft::deque<int>::iterator it = d.begin() + 1100;
+	ft::deque<int>::const_iterator cit = d.end() - 1100;
+	COUT_NC(*it << " " << *cit << " " << (cit - it) << " " << (it < cit) << " " << it[-1000] << " " << *(it -= 1099));
+	ft::deque<int>::reverse_iterator rit = d.rbegin();
+	COUT_NC(*rit << " " << *(rit + 1024) << " " << (d.rend() - d.rbegin()));
+
+	COUT_NC("INSERT --- SINGLE / FILL / RANGE");
+	d.insert(d.begin() + 10, 7);
+	d.insert(d.end() - 10, 3, 8);
+	d.insert(d.begin() + 1500, 2000, 9);
+	ft::vector<int> v(5, 1);
+	for (int i = 0; i < 5; i++)
+		v[i] = i * 100;
+	d.insert(d.begin() + 3, v.begin(), v.end());
+	d.insert(d.end() - 3, v.begin(), v.end());
+	deque_status(d);
+
+	COUT_NC("ERASE --- SINGLE / RANGE");
+	COUT_NC(*d.erase(d.begin() + 3));
+	COUT_NC(*d.erase(d.begin() + 1000, d.begin() + 3000));
+	COUT_NC(*d.erase(d.begin() + 5, d.begin() + 6));
+	COUT_NC((d.erase(d.end() - 5, d.end()) == d.end()));
+	deque_status(d);
+
+	COUT_NC("RESIZE / ASSIGN / CLEAR");
+	d.resize(10);
+	deque_status(d);
+	d.resize(15, 3);
+	deque_status(d);
+	d.assign(v.begin(), v.end());
+	deque_status(d);
+	d.assign(3, 11);
+	deque_status(d);
+	d.clear();
+	deque_status(d);
+	d.push_front(1);
+	deque_status(d);
+
+	COUT_NC("COPY / COMPARISON / SWAP");
+	ft::deque<int> copy(filled);
+	copy.push_back(43);
+	COUT_NC((copy == filled) << (copy != filled) << (filled < copy) << (filled <= copy) << (filled > copy) << (filled >= copy));
+	filled = copy;
+	COUT_NC((copy == filled));
+	swap(d, filled);
+	deque_status(d);
+	deque_status(filled);
+
+	COUT_NC("AT --- OUT OF RANGE");
+	try
+	{
+		d.at(100);
+	}
+	catch (std::out_of_range &e)
+	{
+		COUT_NC("out_of_range");
+	}
+
+	COUT_NC("STACK OVER DEQUE --- DEEP");
+	ft::stack<int> deep;
+	for (int i = 0; i < 100000; i++)
+		deep.push(i);
+	long sum = 0;
+	while (deep.size() > 10)
+	{
+		sum += deep.top();
+		deep.pop();
+	}
+	COUT_NC(sum << " " << deep.top() << " " << deep.size());
 }
 
 void	stack_tests()
@@ -389,10 +608,184 @@ void	map_tests()
 	COUT_NC(std::endl << "RESULT " << it->first << " " << it->second);
 }
 
+bool	by_first(const ft::pair<int, int> &a, const ft::pair<int, int> &b)
+{
+	return (a.first < b.first);
+}
+
+void	algorithm_tests()
+{
+	COUT_NC("------------------------------------------ ALGORITHM ------------------------------------------");
+	ft::vector<int> v;
+	unsigned long seed = 42;
+
+	for (int i = 0; i < 1000; i++)
+	{
+		seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+		v.push_back(static_cast<int>(seed >> 33) % 2001 - 1000);
+	}
+
+	COUT_NC("SORT --- INT");
+	ft::vector<int> sorted(v);
+	ft::sort(sorted.begin(), sorted.end());
+	for (size_t i = 0; i < sorted.size(); i += 50)
+		COUT_NC("[" << i << "] " << sorted[i]);
+	COUT_NC("sorted=" << (std::adjacent_find(sorted.begin(), sorted.end(), std::greater<int>()) == sorted.end()));
+
+	COUT_NC("SORT --- SMALL / GREATER");
+	ft::vector<int> small(v.begin(), v.begin() + 20);
+	ft::sort(small.begin(), small.end(), std::greater<int>());
+	vector_status(small);
+	ft::sort(small.begin(), small.begin());
+	ft::sort(small.begin(), small.begin() + 1);
+	vector_status(small);
+
+	COUT_NC("SORT --- DOUBLE");
+	ft::vector<double> d;
+	for (size_t i = 0; i < v.size(); i++)
+		d.push_back(v[i] / 8.0);
+	d[3] = -0.0;
+	ft::sort(d.begin(), d.end());
+	for (size_t i = 0; i < d.size(); i += 100)
+		COUT_NC("[" << i << "] " << d[i]);
+
+	COUT_NC("SORT --- STRING");
+	ft::vector<std::string> s;
+	for (int i = 0; i < 30; i++)
+		s.push_back(std::string(1, 'a' + (v[i] + 1000) % 26) + std::string(i % 3, 'z'));
+	ft::sort(s.begin(), s.end());
+	for (size_t i = 0; i < s.size(); i++)
+		COUT_NC("[" << i << "] " << s[i]);
+
+	COUT_NC("SORT --- DEQUE");
+	ft::deque<int> dq(v.begin(), v.end());
+	ft::sort(dq.begin(), dq.end());
+	for (size_t i = 0; i < dq.size(); i += 100)
+		COUT_NC("[" << i << "] " << dq[i]);
+	COUT_NC("sorted=" << (std::adjacent_find(dq.begin(), dq.end(), std::greater<int>()) == dq.end()));
+	ft::stable_sort(dq.begin(), dq.end(), std::greater<int>());
+	for (size_t i = 0; i < dq.size(); i += 100)
+		COUT_NC("[" << i << "] " << dq[i]);
+
+	COUT_NC("STABLE_SORT --- PAIR");
+	ft::vector<ft::pair<int, int> > p;
+	for (int i = 0; i < 200; i++)
+		p.push_back(ft::make_pair(v[i] % 10, i));
+	ft::stable_sort(p.begin(), p.end(), by_first);
+	for (size_t i = 0; i < p.size(); i += 10)
+		COUT_NC("[" << i << "] " << p[i].first << " " << p[i].second);
+	ft::stable_sort(sorted.begin(), sorted.end(), std::greater<int>());
+	for (size_t i = 0; i < sorted.size(); i += 100)
+		COUT_NC("[" << i << "] " << sorted[i]);
+}
+
+#if __cplusplus >= 201103L
+void	move_tests()
+{
+	COUT_NC("-------------------------------------------- MOVE --------------------------------------------");
+	ft::vector<std::string> v;
+
+	COUT_NC("VECTOR --- EMPLACE_BACK / PUSH_BACK(&&)");
+	for (int i = 0; i < 5; i++)
+	{
+		std::string s(20, 'a' + i);
+		v.push_back(std::move(s));
+		v.emplace_back(3, 'A' + i);
+	}
+	vector_status(v);
+
+	COUT_NC("VECTOR --- EMPLACE / INSERT(&&)");
+	v.emplace(v.begin() + 2, "emplaced");
+	v.insert(v.begin(), std::string("inserted"));
+	v.emplace(v.begin() + 3, v[5]);
+	vector_status(v);
+
+	COUT_NC("VECTOR --- ERASE EMPTY RANGE");
+	v.erase(v.begin(), v.begin());
+	v.erase(v.begin() + 4, v.begin() + 4);
+	v.erase(v.end(), v.end());
+	vector_status(v);
+
+	COUT_NC("VECTOR --- MOVE CONSTRUCTOR");
+	ft::vector<std::string> v2(std::move(v));
+	vector_status(v);
+	vector_status(v2);
+
+	COUT_NC("VECTOR --- MOVE ASSIGNMENT");
+	v = std::move(v2);
+	vector_status(v);
+	vector_status(v2);
+
+	COUT_NC("VECTOR OF VECTORS --- GROWTH");
+	ft::vector<ft::vector<int> > vv;
+	for (int i = 0; i < 20; i++)
+		vv.emplace_back(i, i);
+	for (size_t i = 0; i < vv.size(); i++)
+		COUT_NC("[" << i << "] size=" << vv[i].size());
+
+	COUT_NC("DEQUE --- EMPLACE / PUSH(&&) / MOVE");
+	ft::deque<std::string> dq;
+	for (int i = 0; i < 5; i++)
+	{
+		dq.emplace_back(3, 'a' + i);
+		dq.emplace_front(2, 'A' + i);
+		dq.push_back(std::string(10, '0' + i));
+	}
+	dq.emplace(dq.begin() + 4, "emplaced");
+	dq.emplace(dq.end() - 2, dq[1]);
+	dq.insert(dq.begin() + 7, std::string("inserted"));
+	deque_status(dq);
+	ft::deque<std::string> dq2(std::move(dq));
+	deque_status(dq);
+	dq = std::move(dq2);
+	deque_status(dq);
+	deque_status(dq2);
+
+	COUT_NC("STACK --- PUSH(&&) / EMPLACE");
+	ft::stack<std::string> st;
+	st.push(std::string("pushed"));
+	st.emplace(4, 'e');
+	COUT_NC(st.top() << " " << st.size());
+	ft::stack<std::string> st2(std::move(st));
+	COUT_NC(st2.top() << " " << st2.size() << " " << st.size());
+	st = std::move(st2);
+	COUT_NC(st.top() << " " << st.size() << " " << st2.size());
+
+	COUT_NC("MAP --- EMPLACE");
+	ft::map<int, std::string> m;
+	for (int i = 0; i < 6; i++)
+		COUT_NC("inserted=" << m.emplace(i % 4, std::string(i + 1, 'm')).second);
+	m.emplace_hint(m.end(), 10, "hint");
+	map_status(m);
+
+	COUT_NC("MAP --- MOVE CONSTRUCTOR");
+	ft::map<int, std::string> m2(std::move(m));
+	map_status(m);
+	map_status(m2);
+
+	COUT_NC("MAP --- MOVE ASSIGNMENT");
+	m = std::move(m2);
+	map_status(m);
+	map_status(m2);
+
+	COUT_NC("PAIR --- MOVE");
+	ft::pair<std::string, std::string> p1("first", "second");
+	ft::pair<std::string, std::string> p2(std::move(p1));
+	COUT_NC(p2.first << " " << p2.second << " [" << p1.first << "]");
+	p1 = std::move(p2);
+	COUT_NC(p1.first << " " << p1.second << " [" << p2.first << "]");
+}
+#endif
+
 int main()
 {
 	vector_tests();
+	deque_tests();
 	stack_tests();
 	map_tests();
+	algorithm_tests();
+#if __cplusplus >= 201103L
+	move_tests();
+#endif
 	return (0);
 }
@@ -0,0 +1,165 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena.cpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** Containers on an arena_allocator next to ones on the heap: copy
+** assignments and swaps between the two hand every block back to the
+** allocator it came from, whatever the vector grows into afterwards, and
+** the elements survive. A map built on an arena takes its nodes from it,
+** and a cleared one can start again after the reset.
+*/
+
+#include "check.hpp"
+#include "../containers/vector.hpp"
+#include "../containers/map.hpp"
+#include "../utils/arena.hpp"
+
+typedef ft::arena_allocator<int>			int_allocator;
+typedef ft::vector<int, int_allocator>		arena_vector;
+
+typedef ft::map<int, int, std::less<int>,
+	ft::arena_allocator<ft::pair<const int, int> > >	arena_map;
+
+bool	counts_up(const arena_vector &v, size_t n, int from)
+{
+	if (v.size() != n)
+		return (false);
+	for (size_t i = 0; i < n; i++)
+	{
+		if (v[i] != from + static_cast<int>(i))
+			return (false);
+	}
+	return (true);
+}
+
+// grows well past its first block
+void	push_from(arena_vector &v, size_t n, int from)
+{
+	for (size_t i = 0; i < n; i++)
+		v.push_back(from + static_cast<int>(i));
+}
+
+void	copy_assignments()
+{
+	ft::arena	a;
+
+	{
+		// an arena's block is never given to operator delete
+		arena_vector	on_arena((int_allocator(a)));
+		arena_vector	on_heap;
+
+		push_from(on_arena, 100, 0);
+		push_from(on_heap, 10, 1000);
+		on_arena = on_heap;
+		CHECK(on_arena.get_allocator() == on_heap.get_allocator());
+		CHECK(counts_up(on_arena, 10, 1000));
+		push_from(on_arena, 1000, 1010);
+		CHECK(counts_up(on_arena, 1010, 1000));
+	}
+	{
+		// nor a heap block left for the arena to forget
+		arena_vector	on_arena((int_allocator(a)));
+		arena_vector	on_heap;
+
+		push_from(on_arena, 10, 0);
+		push_from(on_heap, 100, 1000);
+		on_heap = on_arena;
+		CHECK(on_heap.get_allocator().resource() == &a);
+		push_from(on_heap, 1000, 10);
+		CHECK(counts_up(on_heap, 1010, 0));
+		// same arena on both sides: the storage is reused
+		on_arena = on_heap;
+		CHECK(counts_up(on_arena, 1010, 0));
+	}
+	{
+		arena_vector	on_arena((int_allocator(a)));
+
+		push_from(on_arena, 50, 0);
+		arena_vector	copy(on_arena);
+		CHECK(copy.get_allocator().resource() == &a && counts_up(copy, 50, 0));
+		push_from(copy, 500, 50);
+		CHECK(counts_up(copy, 550, 0));
+	}
+	check::pass("copy assignments between arena and heap");
+}
+
+void	swaps()
+{
+	ft::arena		a;
+	ft::arena		b;
+	arena_vector	on_a((int_allocator(a)));
+	arena_vector	on_b((int_allocator(b)));
+	arena_vector	on_heap;
+
+	push_from(on_a, 100, 0);
+	push_from(on_b, 10, 100);
+	push_from(on_heap, 30, 200);
+	on_a.swap(on_heap);
+	CHECK(on_a.get_allocator().resource() == NULL && counts_up(on_a, 30, 200));
+	CHECK(on_heap.get_allocator().resource() == &a && counts_up(on_heap, 100, 0));
+	// each one grows with the allocator that came with its block
+	push_from(on_a, 1000, 230);
+	push_from(on_heap, 1000, 100);
+	CHECK(counts_up(on_a, 1030, 200) && counts_up(on_heap, 1100, 0));
+	ft::swap(on_b, on_heap);
+	CHECK(on_b.get_allocator().resource() == &a && on_heap.get_allocator().resource() == &b);
+	push_from(on_heap, 1000, 110);
+	CHECK(counts_up(on_heap, 1010, 100) && counts_up(on_b, 1100, 0));
+#if __cplusplus >= 201103L
+	on_a = std::move(on_b);
+	CHECK(on_a.get_allocator().resource() == &a && counts_up(on_a, 1100, 0));
+	push_from(on_a, 100, 1100);
+	CHECK(counts_up(on_a, 1200, 0));
+#endif
+	check::pass("swaps between arenas and the heap");
+}
+
+void	maps()
+{
+	ft::arena	a;
+
+	for (int round = 0; round < 3; round++)
+	{
+		{
+			arena_map	m((std::less<int>()), a);
+
+			for (int i = 0; i < 5000; i++)
+				m[(i * 7919) % 5000] = i;
+			CHECK(m.size() == 5000 && a.used() > 0);
+			for (int k = 0; k < 5000; k += 2)
+				CHECK(m.erase(k) == 1);
+			CHECK(m.size() == 2500 && m.find(1) != m.end() && m.find(2) == m.end());
+
+			arena_map	copy(m);
+			arena_map	other;
+			other[-1] = -1;
+			other.swap(copy);
+			CHECK(other.size() == 2500 && copy.size() == 1);
+			CHECK(ft::equal(m.begin(), m.end(), other.begin()));
+			copy = m;
+			CHECK(copy.size() == 2500);
+		}
+		// every map is gone: the arena can start over
+		a.reset();
+		CHECK(a.used() == 0);
+	}
+	check::pass("maps on an arena, reset between rounds");
+}
+
+int main()
+{
+	check::title("arena_allocator");
+	copy_assignments();
+	swaps();
+	maps();
+	return (0);
+}
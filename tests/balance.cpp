@@ -0,0 +1,237 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   balance.cpp                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** Both balancing policies through random inserts and erases, ascending runs
+** and build_sorted: RBTree::verify() (order, parent links, size and the
+** policy's own invariant) holds throughout, the keys match a std::set, and
+** the depth stays within the policy's bound. A corrupted node must fail
+** verify(), and a stateful comparator goes along with swaps and copies.
+*/
+
+#include "check.hpp"
+#include "../utils/RBTree.hpp"
+#include <cmath>
+#include <set>
+#include <vector>
+
+typedef ft::pair<const int, int>	value_type;
+
+template<class Balance>
+struct tree
+{
+	typedef ft::RBTree<value_type, int, std::less<int>,
+		std::allocator<ft::node<value_type> >, Balance>	type;
+};
+
+// the longest path the policy allows for n nodes
+double	max_depth(ft::rb_balance, size_t n)
+{ return (2 * std::log(n + 1.0) / std::log(2.0)); }
+
+double	max_depth(ft::avl_balance, size_t n)
+{ return (1.4405 * std::log(n + 2.0) / std::log(2.0)); }
+
+// a node the policy's invariant no longer accepts
+template<class Tree>
+void	corrupt(Tree &t, ft::rb_balance)
+{
+	typename Tree::node_type *n = t.root()->left;
+	while (n->color != E_BLACK)
+		n = n->left;
+	CHECK(n != t.sentinel());
+	n->color = E_RED;
+}
+
+template<class Tree>
+void	corrupt(Tree &t, ft::avl_balance)
+{ t.root()->color++; }
+
+template<class Tree>
+bool	same_keys(const Tree &t, const std::set<int> &ref)
+{
+	typename Tree::node_type			*n = t.minimum(t.root());
+	std::set<int>::const_iterator		it = ref.begin();
+
+	if (t.size() != ref.size())
+		return (false);
+	for (; n != t.sentinel() && it != ref.end(); n = t.found_next_one(n), ++it)
+	{
+		if (n->key_val.first != *it || n->key_val.second != -*it)
+			return (false);
+	}
+	return (n == t.sentinel() && it == ref.end());
+}
+
+template<class Balance>
+void	random_writes(const std::string &name, size_t ops)
+{
+	typename tree<Balance>::type	t;
+	std::set<int>					ref;
+	check::rng						rng;
+
+	for (size_t i = 0; i < ops; i++)
+	{
+		int k = static_cast<int>(rng.below(ops));
+		if (rng.below(3) != 0)
+		{
+			if (ref.insert(k).second)
+				t.insert(value_type(k, -k));
+		}
+		else if (ref.erase(k))
+			t.erase(t.find(k));
+		// each verify walks the whole tree
+		if (ref.size() < 256 || i % 257 == 0)
+			CHECK(t.verify());
+		CHECK(t.depth() <= max_depth(Balance(), t.size()));
+	}
+	CHECK(t.verify());
+	CHECK(same_keys(t, ref));
+	while (!ref.empty())
+	{
+		int k = *ref.begin();
+		ref.erase(ref.begin());
+		t.erase(t.find(k));
+		if (ref.size() % 97 == 0)
+			CHECK(t.verify() && same_keys(t, ref));
+	}
+	CHECK(t.size() == 0 && t.root() == t.sentinel());
+	check::pass(name + " random inserts and erases");
+}
+
+template<class Balance>
+void	ascending(const std::string &name, size_t n)
+{
+	typename tree<Balance>::type	t;
+	std::set<int>					ref;
+
+	for (size_t i = 0; i < n; i++)
+	{
+		t.insert(value_type(static_cast<int>(i), -static_cast<int>(i)));
+		ref.insert(static_cast<int>(i));
+	}
+	CHECK(t.verify());
+	CHECK(same_keys(t, ref));
+	CHECK(t.depth() <= max_depth(Balance(), n));
+	for (size_t i = 0; i < n; i += 2)
+	{
+		t.erase(t.find(static_cast<int>(i)));
+		ref.erase(static_cast<int>(i));
+	}
+	CHECK(t.verify());
+	CHECK(same_keys(t, ref));
+	CHECK(t.depth() <= max_depth(Balance(), t.size()));
+	check::pass(name + " ascending run");
+}
+
+template<class Balance>
+void	built(const std::string &name)
+{
+	for (size_t n = 0; n < 300; n++)
+	{
+		typename tree<Balance>::type	t;
+		std::vector<value_type>			sorted;
+		std::set<int>					ref;
+
+		for (size_t i = 0; i < n; i++)
+		{
+			sorted.push_back(value_type(static_cast<int>(i * 3), -static_cast<int>(i * 3)));
+			ref.insert(static_cast<int>(i * 3));
+		}
+		t.build_sorted(sorted.begin(), n);
+		CHECK(t.verify());
+		CHECK(same_keys(t, ref));
+		// still balanced once written to
+		t.insert(value_type(1, -1));
+		ref.insert(1);
+		if (n > 0)
+		{
+			t.erase(t.find(static_cast<int>(n - 1) * 3));
+			ref.erase(static_cast<int>(n - 1) * 3);
+		}
+		CHECK(t.verify());
+		CHECK(same_keys(t, ref));
+	}
+	check::pass(name + " build_sorted");
+}
+
+template<class Balance>
+void	corrupted(const std::string &name)
+{
+	typename tree<Balance>::type	t;
+
+	for (int i = 0; i < 100; i++)
+		t.insert(value_type(i, -i));
+	CHECK(t.verify());
+	corrupt(t, Balance());
+	CHECK(!t.verify());
+	check::pass(name + " corrupted node detected");
+}
+
+// ascending or descending, chosen at run time
+struct directed_less
+{
+	bool	descending;
+
+	directed_less(bool d = false) : descending(d) {}
+
+	bool operator()(int x, int y) const
+	{ return (this->descending ? y < x : x < y); }
+};
+
+template<class Balance>
+void	comparators(const std::string &name)
+{
+	typedef ft::RBTree<value_type, int, directed_less,
+		std::allocator<ft::node<value_type> >, Balance>	directed_tree;
+
+	directed_tree	up((directed_less(false)));
+	directed_tree	down((directed_less(true)));
+
+	for (int i = 0; i < 100; i++)
+	{
+		up.insert(value_type(i, -i));
+		down.insert(value_type(1000 + i, -i));
+	}
+	// each tree keeps the order its nodes were built in
+	up.swap(down);
+	CHECK(up.verify() && down.verify());
+	CHECK(up.minimum(up.root())->key_val.first == 1099);
+	CHECK(down.minimum(down.root())->key_val.first == 0);
+	up.insert(value_type(2000, 0));
+	down.insert(value_type(-1, 0));
+	CHECK(up.verify() && up.minimum(up.root())->key_val.first == 2000);
+	CHECK(down.verify() && down.minimum(down.root())->key_val.first == -1);
+	// a copy takes the comparator along with the nodes
+	directed_tree	copy((directed_less(false)));
+	copy = up;
+	CHECK(copy.verify() && copy.size() == up.size());
+	CHECK(copy.minimum(copy.root())->key_val.first == 2000);
+	check::pass(name + " stateful comparator through swap and copy");
+}
+
+template<class Balance>
+void	run(const std::string &name)
+{
+	check::title(name);
+	random_writes<Balance>(name, 20000);
+	ascending<Balance>(name, 10000);
+	built<Balance>(name);
+	corrupted<Balance>(name);
+	comparators<Balance>(name);
+}
+
+int main()
+{
+	run<ft::rb_balance>("rb_balance");
+	run<ft::avl_balance>("avl_balance");
+	return (0);
+}
@@ -0,0 +1,231 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bloom.cpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** Maps with a bloom_filter front against a std::set of their keys: no key
+** is ever missed across the filter's rebuilds, erased keys are gone even
+** though the filter still answers "maybe" for them, and re-inserted ones
+** come back. After rebuild_filter() the false positive rate on absent keys
+** stays low. Copies, swaps, clear and the bulk builds keep the filter in
+** step with the tree, and threads sharing a const map count every lookup.
+*/
+
+#include "check.hpp"
+#include "../containers/map.hpp"
+#include <set>
+#include <sstream>
+#include <vector>
+#if __cplusplus >= 201103L
+# include <thread>
+#endif
+
+typedef ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >,
+	ft::rb_balance, ft::bloom_filter<int> >							filtered_map;
+
+typedef ft::map<std::string, int, std::less<std::string>,
+	std::allocator<ft::pair<const std::string, int> >,
+	ft::rb_balance, ft::bloom_filter<std::string> >					filtered_string_map;
+
+// every key of ref found in m, every other key of [0, range) absent
+template<class Map>
+bool	same_keys(const Map &m, const std::set<int> &ref, int range)
+{
+	if (m.size() != ref.size())
+		return (false);
+	for (int k = 0; k < range; k++)
+	{
+		typename Map::const_iterator it = m.find(k);
+		if (ref.count(k) ? (it == m.end() || it->first != k) : it != m.end())
+			return (false);
+		if (m.count(k) != ref.count(k))
+			return (false);
+	}
+	return (true);
+}
+
+void	inserts_and_erases()
+{
+	filtered_map	m;
+	std::set<int>	ref;
+	check::rng		rng;
+	int				range = 200000;
+
+	// grows through several filter rebuilds
+	for (int i = 0; i < 100000; i++)
+	{
+		int k = static_cast<int>(rng.below(range));
+		m.insert(ft::make_pair(k, i));
+		ref.insert(k);
+	}
+	CHECK(same_keys(m, ref, range));
+	for (std::set<int>::iterator it = ref.begin(); it != ref.end(); )
+	{
+		if (rng.below(2))
+		{
+			CHECK(m.erase(*it) == 1);
+			ref.erase(it++);
+		}
+		else
+			++it;
+	}
+	CHECK(same_keys(m, ref, range));
+	// a range erase, then erased keys inserted again
+	m.erase(m.lower_bound(1000), m.lower_bound(5000));
+	ref.erase(ref.lower_bound(1000), ref.lower_bound(5000));
+	CHECK(same_keys(m, ref, range));
+	for (int k = 0; k < 3000; k += 3)
+	{
+		m[k] = k;
+		ref.insert(k);
+	}
+	CHECK(same_keys(m, ref, range));
+	check::pass("inserts and erases");
+
+	m.rebuild_filter();
+	CHECK(same_keys(m, ref, range));
+	unsigned long negatives = m.filter().negatives();
+	unsigned long false_positives = m.filter().false_positives();
+	for (int k = range; k < 2 * range; k++)
+		CHECK(m.find(k) == m.end());
+	negatives = m.filter().negatives() - negatives;
+	false_positives = m.filter().false_positives() - false_positives;
+	CHECK(negatives + false_positives == static_cast<unsigned long>(range));
+	CHECK(false_positives < static_cast<unsigned long>(range / 20));
+	check::pass("false positive rate after rebuild_filter");
+}
+
+void	copies_and_swaps()
+{
+	filtered_map	a;
+	filtered_map	b;
+	std::set<int>	ref_a;
+	std::set<int>	ref_b;
+
+	for (int k = 0; k < 20000; k += 2)
+	{
+		a.insert(ft::make_pair(k, k));
+		ref_a.insert(k);
+	}
+	for (int k = 1; k < 3000; k += 2)
+	{
+		b.insert(ft::make_pair(k, k));
+		ref_b.insert(k);
+	}
+	a.swap(b);
+	CHECK(same_keys(a, ref_b, 20000));
+	CHECK(same_keys(b, ref_a, 20000));
+	ft::swap(a, b);
+	CHECK(same_keys(a, ref_a, 20000));
+	CHECK(same_keys(b, ref_b, 20000));
+
+	filtered_map	c(a);
+	filtered_map	d;
+	d = b;
+	CHECK(same_keys(c, ref_a, 20000));
+	CHECK(same_keys(d, ref_b, 20000));
+	// copies learn on their own
+	c.insert(ft::make_pair(1, 1));
+	CHECK(c.find(1) != c.end() && a.find(1) == a.end());
+
+	a.clear();
+	CHECK(same_keys(a, std::set<int>(), 20000));
+	a.insert(ft::make_pair(7, 7));
+	CHECK(a.find(7) != a.end() && a.size() == 1);
+	check::pass("copies, swaps and clear");
+}
+
+void	bulk_builds()
+{
+	std::vector<ft::pair<int, int> >	sorted;
+	std::set<int>						ref;
+	filtered_map						m;
+
+	for (int k = 0; k < 50000; k += 5)
+	{
+		sorted.push_back(ft::make_pair(k, k));
+		ref.insert(k);
+	}
+	m.insert(ft::make_pair(3, 3));
+	m.build_sorted(sorted.begin(), sorted.end());
+	CHECK(same_keys(m, ref, 50000));
+
+	std::vector<ft::pair<int, int> >	shuffled(sorted.rbegin(), sorted.rend());
+	filtered_map						p;
+#if __cplusplus >= 201103L
+	p.build_parallel(shuffled.begin(), shuffled.end());
+#else
+	p.insert(shuffled.begin(), shuffled.end());
+#endif
+	CHECK(same_keys(p, ref, 50000));
+	check::pass("bulk builds");
+}
+
+void	string_keys()
+{
+	filtered_string_map	m;
+
+	for (int i = 0; i < 5000; i++)
+	{
+		std::ostringstream key;
+		key << "key" << i;
+		m[key.str()] = i;
+	}
+	for (int i = 0; i < 10000; i++)
+	{
+		std::ostringstream key;
+		key << "key" << i;
+		filtered_string_map::iterator it = m.find(key.str());
+		CHECK(i < 5000 ? it != m.end() && it->second == i : it == m.end());
+	}
+	check::pass("string keys");
+}
+
+#if __cplusplus >= 201103L
+void	const_finds()
+{
+	filtered_map				m;
+	std::vector<std::thread>	readers;
+
+	for (int k = 0; k < 20000; k += 2)
+		m.insert(ft::make_pair(k, k));
+	m.rebuild_filter();
+
+	const filtered_map	&shared = m;
+	unsigned long		queries = m.filter().queries();
+	unsigned long		absent = m.filter().negatives() + m.filter().false_positives();
+	for (int t = 0; t < 4; t++)
+	{
+		readers.push_back(std::thread([&shared]() {
+			for (int k = 0; k < 20000; k++)
+				CHECK((shared.find(k) != shared.end()) == (k % 2 == 0));
+		}));
+	}
+	for (size_t t = 0; t < readers.size(); t++)
+		readers[t].join();
+	CHECK(m.filter().queries() - queries == 4 * 20000);
+	CHECK(m.filter().negatives() + m.filter().false_positives() - absent == 4 * 10000);
+	check::pass("finds on a const map from 4 threads");
+}
+#endif
+
+int main()
+{
+	check::title("map with a bloom_filter");
+	inserts_and_erases();
+	copies_and_swaps();
+	bulk_builds();
+	string_keys();
+#if __cplusplus >= 201103L
+	const_finds();
+#endif
+	return (0);
+}
@@ -0,0 +1,175 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   buffered_map.cpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** buffered_map against a plain ft::map taking the same random inserts,
+** operator[] writes, erases and flushes, with a buffer small enough to
+** fill up every few writes. The merged iteration, find, count and size
+** must match the map after each operation, whether the key sits in the
+** buffer, in the tree or in both; copies and clear included.
+*/
+
+#include "check.hpp"
+#include "../containers/buffered_map.hpp"
+
+typedef ft::buffered_map<int, int, std::less<int>,
+	std::allocator<ft::pair<const int, int> >, 8>	small_buffered;
+typedef ft::map<int, int>							model;
+
+bool	same(const small_buffered &b, const model &m)
+{
+	small_buffered::const_iterator	it = b.begin();
+	model::const_iterator			ref = m.begin();
+
+	if (b.size() != m.size() || b.empty() != m.empty())
+		return (false);
+	for (; it != b.end() && ref != m.end(); ++it, ++ref)
+	{
+		if (it->first != ref->first || it->second != ref->second)
+			return (false);
+	}
+	return (it == b.end() && ref == m.end());
+}
+
+// find and count for every key in range, present or not
+bool	same_lookups(const small_buffered &b, const model &m, int range)
+{
+	for (int k = -1; k <= range; k++)
+	{
+		small_buffered::const_iterator	it = b.find(k);
+		model::const_iterator			ref = m.find(k);
+
+		if (b.count(k) != m.count(k))
+			return (false);
+		if (ref == m.end() ? it != b.end() : it == b.end() || it->first != k || it->second != ref->second)
+			return (false);
+	}
+	return (true);
+}
+
+void	random_ops()
+{
+	check::rng		rng;
+	small_buffered	b;
+	model			m;
+	int				range = 64;
+
+	for (int op = 0; op < 20000; op++)
+	{
+		int k = static_cast<int>(rng.below(range));
+		int v = static_cast<int>(rng.below(1000));
+
+		switch (rng.below(6))
+		{
+			case 0:
+			case 1:
+				// a key already in the tree keeps its value
+				b.insert(ft::make_pair(k, v));
+				m.insert(ft::make_pair(k, v));
+				break ;
+			case 2:
+				b[k] += v;
+				m[k] += v;
+				break ;
+			case 3:
+				CHECK(b.erase(k) == m.erase(k));
+				break ;
+			case 4:
+				if (rng.below(8) == 0)
+				{
+					b.flush();
+					CHECK(b.pending() == 0);
+				}
+				break ;
+			default:
+			{
+				const small_buffered	&cb = b;
+				CHECK(cb.size() == m.size());
+			}
+		}
+		CHECK(b.pending() <= 8);
+		CHECK(same(b, m));
+		if (op % 64 == 0)
+			CHECK(same_lookups(b, m, range));
+	}
+	CHECK(same_lookups(b, m, range));
+	CHECK(ft::equal(b.merged().begin(), b.merged().end(), m.begin()));
+	CHECK(b.pending() == 0);
+	check::pass("random operations against ft::map");
+}
+
+void	shadowed_keys()
+{
+	small_buffered	b;
+	model			m;
+
+	// in the tree first, then buffered again: the tree's value wins
+	for (int k = 0; k < 20; k++)
+	{
+		b.insert(ft::make_pair(k, k));
+		m.insert(ft::make_pair(k, k));
+	}
+	b.flush();
+	for (int k = 10; k < 30; k++)
+	{
+		b.insert(ft::make_pair(k, -k));
+		m.insert(ft::make_pair(k, -k));
+	}
+	CHECK(b.pending() > 0 && same(b, m) && same_lookups(b, m, 30));
+	// operator[] on a shadowed key drops the buffered copy
+	b[15] = 150;
+	m[15] = 150;
+	CHECK(same(b, m) && b.find(15)->second == 150);
+	// erase removes it from both places
+	CHECK(b.erase(16) == 1 && m.erase(16) == 1);
+	CHECK(b.find(16) == b.end() && b.count(16) == 0);
+	CHECK(same(b, m));
+	b.flush();
+	CHECK(same(b, m) && same_lookups(b, m, 30));
+	check::pass("keys in both the buffer and the tree");
+}
+
+void	copies()
+{
+	small_buffered	b;
+	model			m;
+
+	for (int k = 0; k < 50; k += 3)
+	{
+		b.insert(ft::make_pair(k, k));
+		m.insert(ft::make_pair(k, k));
+	}
+	CHECK(b.pending() > 0);
+
+	small_buffered	copy(b);
+	small_buffered	assigned;
+	assigned[100] = 1;
+	assigned = b;
+	CHECK(same(copy, m) && same(assigned, m));
+	copy[1] = 1;
+	CHECK(b.count(1) == 0 && copy.count(1) == 1);
+
+	b.clear();
+	CHECK(b.empty() && b.size() == 0 && b.begin() == b.end());
+	b.insert(ft::make_pair(5, 5));
+	CHECK(b.size() == 1 && b.find(5)->second == 5);
+	check::pass("copies, assignment and clear");
+}
+
+int main()
+{
+	check::title("buffered_map, 8 buffered writes");
+	random_ops();
+	shadowed_keys();
+	copies();
+	return (0);
+}
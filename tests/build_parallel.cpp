@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   build_parallel.cpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** map::build_parallel against insert of the same unsorted input, where
+** most keys come several times with a different value each time: the
+** first value must win, as with insert. Both balancing policies, pools of
+** 0 and 4 workers, sizes on both sides of the 4096 elements below which a
+** subtree is built on one thread. Built at FT_HARDENING 2 whatever the
+** Makefile says, so RBTree::verify() walks every tree built and aborts if
+** an invariant is broken.
+*/
+
+#undef FT_HARDENING
+#define FT_HARDENING 2
+
+#include "check.hpp"
+
+#if __cplusplus >= 201103L
+# include <vector>
+# include "../containers/map.hpp"
+
+typedef ft::map<int, long, std::less<int>, std::allocator<ft::pair<const int, long> >,
+	ft::rb_balance>		rb_map;
+typedef ft::map<int, long, std::less<int>, std::allocator<ft::pair<const int, long> >,
+	ft::avl_balance>	avl_map;
+
+static const size_t		workers[] = { 0, 4 };
+static const size_t		sizes[] = { 0, 1, 2, 100, 4095, 4096, 4097, 8193 };
+
+// n distinct keys, each one to three times, shuffled; values number the
+// occurrences so the one kept shows
+std::vector<ft::pair<int, long> >	input(size_t n)
+{
+	check::rng							rng(n + 1);
+	std::vector<ft::pair<int, long> >	entries;
+
+	for (size_t i = 0; i < n; i++)
+	{
+		int key = static_cast<int>(i * 7) - static_cast<int>(n);
+		for (size_t times = 1 + rng.below(3); times > 0; times--)
+			entries.push_back(ft::make_pair(key, 0L));
+	}
+	for (size_t i = entries.size(); i > 1; i--)
+		std::swap(entries[i - 1], entries[rng.below(i)]);
+	for (size_t i = 0; i < entries.size(); i++)
+		entries[i].second = static_cast<long>(i);
+	return (entries);
+}
+
+template<class Map>
+void	built(const std::string &name)
+{
+	for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+	{
+		std::vector<ft::pair<int, long> >	entries = input(sizes[s]);
+		Map									inserted;
+
+		for (size_t i = 0; i < entries.size(); i++)
+			inserted.insert(entries[i]);
+		for (size_t w = 0; w < sizeof(workers) / sizeof(workers[0]); w++)
+		{
+			ft::thread_pool	pool(workers[w]);
+			Map				built;
+
+			// replaces what was there
+			for (int k = -3; k < 3; k++)
+				built.insert(ft::make_pair(k * 1000003, -1L));
+			built.build_parallel(entries.begin(), entries.end(), pool);
+			CHECK(built.size() == sizes[s] && built == inserted);
+			// still a working tree, verified again on each change
+			built.insert(ft::make_pair(1 << 30, 1L));
+			CHECK(built.size() == sizes[s] + 1 && built.erase(1 << 30) == 1);
+			CHECK(built == inserted);
+		}
+	}
+	check::pass(name + " on 0 and 4 workers");
+	// the global pool, and bidirectional input
+	std::vector<ft::pair<int, long> >	entries = input(5000);
+	Map									inserted(entries.begin(), entries.end());
+	Map									built;
+
+	built.build_parallel(entries.begin(), entries.end());
+	CHECK(built == inserted);
+	built.build_parallel(inserted.begin(), inserted.end());
+	CHECK(built == inserted);
+	check::pass(name + " on the global pool and from a map");
+}
+
+int main()
+{
+	check::title("build_parallel against insert");
+	built<rb_map>("rb_balance");
+	built<avl_map>("avl_balance");
+	return (0);
+}
+#else
+int main()
+{
+	COUT(B_CYAN, "build_parallel needs C++11 (make check17)");
+	return (0);
+}
+#endif
@@ -0,0 +1,65 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   check.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include "../utils/utils.hpp"
+
+/*
+** SELF-CHECKING TESTS
+** For what main_ft.cpp cannot diff against std: the ft-only containers and
+** members. Each program checks its own results and exits 1 on the first
+** failed CHECK, printing where.
+*/
+
+#define CHECK(cond) ((cond) ? (void)0 : check::fail(#cond, __FILE__, __LINE__))
+
+namespace check
+{
+	inline void fail(const char *what, const char *file, int line)
+	{
+		std::cout << B_RED << file << ":" << line << ": CHECK(" << what << ") failed"
+			<< RESET << std::endl;
+		std::exit(1);
+	}
+
+	inline void title(const std::string &name)
+	{ COUT(B_CYAN, "---- " << name << " ----"); }
+
+	inline void pass(const std::string &name)
+	{ COUT(B_GREEN, "ok  " << name); }
+
+	// xorshift64, deterministic across runs
+	class rng
+	{
+		public:
+			explicit rng(unsigned long seed = 88172645463325252UL) : _state(seed) {}
+
+			unsigned long next()
+			{
+				_state ^= _state << 13;
+				_state ^= _state >> 7;
+				_state ^= _state << 17;
+				return (_state);
+			}
+
+			// in [0, n)
+			unsigned long below(unsigned long n)
+			{ return (next() % n); }
+
+		private:
+			unsigned long	_state;
+	};
+}
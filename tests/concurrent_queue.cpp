@@ -0,0 +1,310 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_queue.cpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** spsc_queue and mpmc_queue: full and empty rings from one thread, then
+** threads on both sides of a small ring. The spsc consumer must get the
+** exact sequence pushed, one by one or in random batches; mpmc consumers
+** must get every value exactly once, each producer's values in the order
+** it pushed them. A throwing constructor hands its mpmc slot over empty,
+** and no element is leaked or destroyed twice.
+*/
+
+#include "check.hpp"
+
+#if __cplusplus >= 201103L
+# include <atomic>
+# include <memory>
+# include <thread>
+# include <vector>
+# include "../containers/concurrent_queue.hpp"
+
+static const long	threads = 4;
+static const long	per_thread = 100000;
+
+long	encode(long t, long j)
+{ return (t * per_thread + j); }
+
+template<class Queue, class Value>
+void	push(Queue &q, Value val)
+{
+	while (!q.try_push(val))
+		std::this_thread::yield();
+}
+
+template<class Queue, class Value>
+void	pop(Queue &q, Value &val)
+{
+	while (!q.try_pop(val))
+		std::this_thread::yield();
+}
+
+// counts its live instances; building from a value ending in 3 throws
+struct counted
+{
+	static std::atomic<long>	live;
+	long						value;
+
+	counted(long v = 0) : value(v)
+	{
+		if (v % 10 == 3)
+			throw std::runtime_error("counted");
+		live++;
+	}
+
+	counted(const counted &x) : value(x.value)
+	{ live++; }
+
+	counted &operator=(const counted &x)
+	{
+		value = x.value;
+		return (*this);
+	}
+
+	~counted()
+	{
+		CHECK(live.load() > 0);
+		live--;
+	}
+};
+
+std::atomic<long>	counted::live(0);
+
+template<class Queue>
+void	full_and_empty(const std::string &name, Queue &q)
+{
+	long val = -1;
+
+	CHECK(q.empty() && !q.try_pop(val) && val == -1);
+	// around the ring several times
+	for (long round = 0; round < 10; round++)
+	{
+		for (size_t i = 0; i < q.capacity(); i++)
+			CHECK(q.try_push(static_cast<long>(i) + round));
+		CHECK(!q.try_push(-1) && q.size() == q.capacity());
+		for (size_t i = 0; i < q.capacity(); i++)
+			CHECK(q.try_pop(val) && val == static_cast<long>(i) + round);
+		CHECK(q.empty() && !q.try_pop(val));
+	}
+	check::pass(name + " full and empty from one thread");
+}
+
+void	spsc_sequence()
+{
+	ft::spsc_queue<long, 64>	q;
+	std::thread					producer([&q]() {
+		for (long i = 0; i < threads * per_thread; i++)
+			push(q, i);
+	});
+	long						val;
+
+	for (long i = 0; i < threads * per_thread; i++)
+	{
+		pop(q, val);
+		CHECK(val == i);
+	}
+	producer.join();
+	CHECK(q.empty());
+	check::pass("spsc_queue one by one across threads");
+}
+
+void	spsc_batches()
+{
+	ft::spsc_queue<long, 64>	q;
+	long						total = threads * per_thread;
+	std::thread					producer([&]() {
+		check::rng	rng(1);
+		long		buf[100];
+		for (long i = 0; i < total; )
+		{
+			size_t n = 1 + rng.below(100);
+			if (n > static_cast<size_t>(total - i))
+				n = total - i;
+			for (size_t k = 0; k < n; k++)
+				buf[k] = i + k;
+			size_t done = 0;
+			while ((done += q.push_n(buf + done, n - done)) < n)
+				std::this_thread::yield();
+			i += n;
+		}
+	});
+	check::rng	rng(2);
+	long		buf[100];
+
+	for (long i = 0; i < total; )
+	{
+		size_t got = q.pop_n(buf, 1 + rng.below(100));
+		if (got == 0)
+			std::this_thread::yield();
+		for (size_t k = 0; k < got; k++)
+			CHECK(buf[k] == i + static_cast<long>(k));
+		i += got;
+	}
+	producer.join();
+	CHECK(q.empty());
+	check::pass("spsc_queue push_n / pop_n across threads");
+}
+
+void	spsc_elements()
+{
+	{
+		ft::spsc_queue<std::unique_ptr<long>, 8>	q;
+		std::unique_ptr<long>						out;
+
+		CHECK(q.try_push(std::unique_ptr<long>(new long(1))));
+		CHECK(q.try_emplace(new long(2)));
+		CHECK(q.try_pop(out) && *out == 1);
+		CHECK(q.try_pop(out) && *out == 2);
+		// left in the queue for its destructor
+		q.try_emplace(new long(3));
+	}
+	{
+		ft::spsc_queue<counted, 8>	q;
+		counted						batch[5] = { 0, 1, 2, 4, 5 };
+
+		CHECK(q.push_n(batch, 5) == 5 && q.size() == 5);
+		CHECK(q.push_n(batch, 5) == 3 && q.size() == 8);
+		CHECK(q.pop_n(batch, 2) == 2 && batch[1].value == 1);
+		try
+		{
+			q.try_emplace(13);
+			CHECK(false);
+		}
+		catch (const std::runtime_error &)
+		{
+		}
+		CHECK(q.size() == 6);
+	}
+	CHECK(counted::live.load() == 0);
+	check::pass("spsc_queue move-only and counted elements");
+}
+
+void	mpmc_threads()
+{
+	ft::mpmc_queue<long>		q(64);
+	std::vector<std::atomic<bool> >	seen(threads * per_thread);
+	std::atomic<long>			popped(0);
+	std::vector<std::thread>	workers;
+
+	for (long t = 0; t < threads; t++)
+	{
+		workers.push_back(std::thread([&q, t]() {
+			for (long j = 0; j < per_thread; j++)
+				push(q, encode(t, j));
+		}));
+		workers.push_back(std::thread([&]() {
+			std::vector<long>	last(threads, -1);
+			long				val;
+			while (popped.load() < threads * per_thread)
+			{
+				if (!q.try_pop(val))
+				{
+					std::this_thread::yield();
+					continue ;
+				}
+				popped++;
+				CHECK(val >= 0 && val < threads * per_thread);
+				CHECK(!seen[val].exchange(true));
+				// each producer's values come out in its order
+				CHECK(val > last[val / per_thread]);
+				last[val / per_thread] = val;
+			}
+		}));
+	}
+	for (size_t i = 0; i < workers.size(); i++)
+		workers[i].join();
+	for (size_t i = 0; i < seen.size(); i++)
+		CHECK(seen[i].load());
+	CHECK(q.empty());
+	check::pass("mpmc_queue 4 producers, 4 consumers");
+}
+
+void	mpmc_throwing()
+{
+	{
+		ft::mpmc_queue<counted>		q(16);
+		std::atomic<long>			pushed(0);
+		std::atomic<long>			popped(0);
+		std::atomic<long>			producers(threads);
+		std::vector<std::thread>	workers;
+
+		for (long t = 0; t < threads; t++)
+		{
+			workers.push_back(std::thread([&, t]() {
+				for (long j = 0; j < per_thread / 10; j++)
+				{
+					try
+					{
+						while (!q.try_emplace(encode(t, j)))
+							std::this_thread::yield();
+						pushed++;
+					}
+					catch (const std::runtime_error &)
+					{
+					}
+				}
+				producers--;
+			}));
+			workers.push_back(std::thread([&]() {
+				counted	out;
+				// the empty slots are skipped, never popped
+				while (producers.load() > 0 || !q.empty())
+				{
+					if (q.try_pop(out))
+					{
+						CHECK(out.value % 10 != 3);
+						popped++;
+					}
+					else
+						std::this_thread::yield();
+				}
+			}));
+		}
+		for (size_t i = 0; i < workers.size(); i++)
+			workers[i].join();
+		CHECK(pushed.load() == threads * per_thread / 10 * 9 / 10);
+		CHECK(popped.load() == pushed.load());
+		// some left for the destructor
+		for (long i = 0; i < 10; i++)
+			q.try_emplace(10 * i);
+	}
+	CHECK(counted::live.load() == 0);
+	check::pass("mpmc_queue throwing constructors");
+}
+
+int main()
+{
+	check::title("spsc_queue");
+	{
+		ft::spsc_queue<long, 64>	q;
+		full_and_empty("spsc_queue", q);
+	}
+	spsc_sequence();
+	spsc_batches();
+	spsc_elements();
+	check::title("mpmc_queue");
+	{
+		ft::mpmc_queue<long>	q(50);
+		CHECK(q.capacity() == 64 && ft::mpmc_queue<long>(0).capacity() == 2);
+		full_and_empty("mpmc_queue", q);
+	}
+	mpmc_threads();
+	mpmc_throwing();
+	return (0);
+}
+#else
+int main()
+{
+	COUT(B_CYAN, "concurrent_queue needs C++11 (make check17)");
+	return (0);
+}
+#endif
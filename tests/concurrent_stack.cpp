@@ -0,0 +1,259 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_stack.cpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** concurrent_stack and bounded_concurrent_stack: LIFO order from one
+** thread, then producers and consumers at once, and threads that each
+** push and pop in turn (recycling nodes as fast as they can, where a
+** missed ABA would lose or duplicate values). Every value pushed must be
+** popped exactly once. The bounded stack refuses pushes when full, and a
+** throwing constructor gives its node back.
+*/
+
+#include "check.hpp"
+
+#if __cplusplus >= 201103L
+# include <atomic>
+# include <memory>
+# include <thread>
+# include <vector>
+# include "../containers/concurrent_stack.hpp"
+
+static const long	threads = 4;
+static const long	per_thread = 50000;
+
+long	encode(long t, long j)
+{ return (t * per_thread + j); }
+
+template<class Body>
+void	run_threads(long n, Body body)
+{
+	std::vector<std::thread>	workers;
+
+	for (long t = 0; t < n; t++)
+		workers.push_back(std::thread(body, t));
+	for (size_t t = 0; t < workers.size(); t++)
+		workers[t].join();
+}
+
+// pushes until it fits, for the bounded stack
+template<class Stack>
+void	push(Stack &s, long val)
+{ s.push(val); }
+
+void	push(ft::bounded_concurrent_stack<long> &s, long val)
+{
+	while (!s.push(val))
+		std::this_thread::yield();
+}
+
+// values popped by all threads, each one marked once
+class tally
+{
+	public:
+		tally() : _seen(threads * per_thread) {}
+
+		void mark(long val)
+		{
+			CHECK(val >= 0 && val < threads * per_thread);
+			CHECK(!_seen[val].exchange(true));
+		}
+
+		bool all() const
+		{
+			for (size_t i = 0; i < _seen.size(); i++)
+			{
+				if (!_seen[i].load())
+					return (false);
+			}
+			return (true);
+		}
+
+	private:
+		std::vector<std::atomic<bool> >	_seen;
+};
+
+template<class Stack>
+void	lifo(const std::string &name, Stack &s)
+{
+	long val = -1;
+
+	CHECK(s.empty() && !s.try_pop(val) && val == -1);
+	for (long i = 0; i < 1000; i++)
+		push(s, i);
+	CHECK(s.size() == 1000);
+	for (long i = 999; i >= 0; i--)
+		CHECK(s.try_pop(val) && val == i);
+	CHECK(s.empty() && s.size() == 0);
+	check::pass(name + " LIFO from one thread");
+}
+
+template<class Stack>
+void	producers_consumers(const std::string &name, Stack &s)
+{
+	tally				seen;
+	std::atomic<long>	popped(0);
+
+	run_threads(2 * threads, [&](long t) {
+		if (t < threads)
+		{
+			for (long j = 0; j < per_thread; j++)
+				push(s, encode(t, j));
+			return ;
+		}
+		long val;
+		while (popped.load() < threads * per_thread)
+		{
+			if (s.try_pop(val))
+			{
+				seen.mark(val);
+				popped++;
+			}
+			else
+				std::this_thread::yield();
+		}
+	});
+	CHECK(seen.all() && s.empty() && s.size() == 0);
+	check::pass(name + " 4 producers, 4 consumers");
+}
+
+template<class Stack>
+void	push_pop_turns(const std::string &name, Stack &s)
+{
+	tally	seen;
+
+	run_threads(threads, [&](long t) {
+		long val;
+		// each thread's push comes first, a pop always finds something
+		for (long j = 0; j < per_thread; j++)
+		{
+			push(s, encode(t, j));
+			CHECK(s.try_pop(val));
+			seen.mark(val);
+		}
+	});
+	CHECK(seen.all() && s.empty());
+	check::pass(name + " push / pop turns from 4 threads");
+}
+
+// counts its live instances; building from a negative value throws
+struct fragile
+{
+	static std::atomic<long>	live;
+	long						value;
+
+	fragile(long v) : value(v)
+	{
+		if (v < 0)
+			throw std::runtime_error("fragile");
+		live++;
+	}
+
+	fragile(const fragile &x) : value(x.value)
+	{ live++; }
+
+	fragile &operator=(const fragile &x)
+	{
+		value = x.value;
+		return (*this);
+	}
+
+	~fragile()
+	{ live--; }
+};
+
+std::atomic<long>	fragile::live(0);
+
+void	bounded_limits()
+{
+	{
+		ft::bounded_concurrent_stack<fragile>	s(64);
+		std::atomic<long>						thrown(0);
+
+		CHECK(s.capacity() == 64);
+		// failed constructions must not use up nodes
+		run_threads(threads, [&](long t) {
+			for (long j = 0; j < 1000; j++)
+			{
+				try
+				{
+					s.emplace(-1 - t);
+				}
+				catch (const std::runtime_error &)
+				{
+					thrown++;
+				}
+			}
+		});
+		CHECK(thrown.load() == threads * 1000 && s.empty());
+		for (long i = 0; i < 64; i++)
+			CHECK(s.push(fragile(i)));
+		CHECK(!s.push(fragile(64)) && s.size() == 64);
+		fragile out(0);
+		CHECK(s.try_pop(out) && out.value == 63);
+		CHECK(s.push(fragile(65)));
+	}
+	CHECK(fragile::live.load() == 0);
+	check::pass("bounded_concurrent_stack full and throwing pushes");
+}
+
+void	move_only()
+{
+	ft::concurrent_stack<std::unique_ptr<long> >	s;
+	std::unique_ptr<long>							out;
+
+	run_threads(threads, [&](long t) {
+		for (long j = 0; j < 1000; j++)
+			s.push(std::unique_ptr<long>(new long(encode(t, j))));
+	});
+	long n = 0;
+	while (s.try_pop(out))
+	{
+		CHECK(out.get() != NULL);
+		n++;
+	}
+	CHECK(n == threads * 1000);
+	s.emplace(new long(7));
+	check::pass("move-only elements");
+}
+
+int main()
+{
+	check::title("concurrent_stack");
+	{
+		ft::concurrent_stack<long>	s;
+		lifo("concurrent_stack", s);
+		producers_consumers("concurrent_stack", s);
+		push_pop_turns("concurrent_stack", s);
+	}
+	move_only();
+	check::title("bounded_concurrent_stack");
+	{
+		ft::bounded_concurrent_stack<long>	s(1024);
+		lifo("bounded_concurrent_stack", s);
+		producers_consumers("bounded_concurrent_stack", s);
+	}
+	{
+		// one node per thread: pushes wait for the nodes being recycled
+		ft::bounded_concurrent_stack<long>	s(threads);
+		push_pop_turns("bounded_concurrent_stack", s);
+	}
+	bounded_limits();
+	return (0);
+}
+#else
+int main()
+{
+	COUT(B_CYAN, "concurrent_stack needs C++11 (make check17)");
+	return (0);
+}
+#endif
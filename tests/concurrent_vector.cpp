@@ -0,0 +1,226 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_vector.cpp                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** concurrent_vector appended to by several threads at once: every value
+** pushed lands exactly once, at the position push_back returned, in each
+** thread's own order; grow_by blocks stay contiguous; readers following
+** the writers see built elements only. Constructors throwing from several
+** threads leave empty slots that the copy and the destructor skip, with
+** no element leaked or destroyed twice.
+*/
+
+#include "check.hpp"
+
+#if __cplusplus >= 201103L
+# include <atomic>
+# include <thread>
+# include <vector>
+# include "../containers/concurrent_vector.hpp"
+
+static const long	threads = 4;
+static const long	per_thread = 50000;
+
+// thread t's j-th value
+long	encode(long t, long j)
+{ return (t * per_thread + j); }
+
+template<class Body>
+void	run_threads(long n, Body body)
+{
+	std::vector<std::thread>	workers;
+
+	for (long t = 0; t < n; t++)
+		workers.push_back(std::thread(body, t));
+	for (size_t t = 0; t < workers.size(); t++)
+		workers[t].join();
+}
+
+void	push_backs()
+{
+	ft::concurrent_vector<long>	v;
+
+	run_threads(threads, [&v](long t) {
+		for (long j = 0; j < per_thread; j++)
+		{
+			ft::concurrent_vector<long>::iterator it = v.push_back(encode(t, j));
+			CHECK(*it == encode(t, j));
+		}
+	});
+	CHECK(v.size() == static_cast<size_t>(threads * per_thread));
+
+	std::vector<char>	seen(v.size(), 0);
+	std::vector<long>	next(threads, 0);
+	for (size_t i = 0; i < v.size(); i++)
+	{
+		long t = v[i] / per_thread;
+		CHECK(v[i] >= 0 && t < threads && !seen[v[i]]);
+		seen[v[i]] = 1;
+		// a thread's values keep the order it pushed them in
+		CHECK(v[i] % per_thread == next[t]);
+		next[t]++;
+	}
+	check::pass("push_back from 4 threads");
+}
+
+void	grow_bys()
+{
+	ft::concurrent_vector<long>	v;
+	std::atomic<size_t>			total(0);
+
+	run_threads(threads, [&](long t) {
+		check::rng			rng(t + 1);
+		std::vector<long>	range;
+
+		for (long batch = 0; batch < 2000; batch++)
+		{
+			size_t								n = 1 + rng.below(64);
+			long								val = encode(t, batch);
+			ft::concurrent_vector<long>::iterator	first;
+
+			if (batch % 2)
+				first = v.grow_by(n, val);
+			else
+			{
+				range.assign(n, val);
+				first = v.grow_by(range.begin(), range.end());
+			}
+			for (size_t i = 0; i < n; i++)
+				CHECK(first[i] == val);
+			total += n;
+		}
+	});
+	CHECK(v.size() == total.load());
+	// blocks never interleave: each value is one run
+	std::vector<char>	seen(threads * per_thread, 0);
+	for (size_t i = 0; i < v.size(); i++)
+	{
+		if (i > 0 && v[i] == v[i - 1])
+			continue ;
+		CHECK(!seen[v[i]]);
+		seen[v[i]] = 1;
+	}
+	check::pass("grow_by from 4 threads");
+}
+
+void	readers()
+{
+	ft::concurrent_vector<long>		v;
+	std::atomic<long>				published[threads];
+	std::atomic<long>				writers(threads);
+	std::thread						reader;
+
+	for (long t = 0; t < threads; t++)
+		published[t] = -1;
+	// the index of each writer's last value, read back while they append
+	reader = std::thread([&]() {
+		std::vector<long>	last(threads, -1);
+		while (writers.load() > 0)
+		{
+			for (long t = 0; t < threads; t++)
+			{
+				long i = published[t].load(std::memory_order_acquire);
+				if (i < 0)
+					continue ;
+				CHECK(static_cast<size_t>(i) < v.size());
+				CHECK(v[i] / per_thread == t && v[i] >= last[t]);
+				last[t] = v[i];
+			}
+		}
+	});
+	run_threads(threads, [&](long t) {
+		for (long j = 0; j < per_thread; j++)
+			published[t].store(v.push_back(encode(t, j)).index(), std::memory_order_release);
+		writers--;
+	});
+	reader.join();
+	check::pass("reads alongside the appends");
+}
+
+// counts its live instances; building from a value ending in 7 throws
+struct fragile
+{
+	static std::atomic<long>	live;
+	long						value;
+
+	explicit fragile(long v) : value(v)
+	{
+		if (v % 10 == 7)
+			throw std::runtime_error("fragile");
+		live++;
+	}
+
+	fragile(const fragile &x) : value(x.value)
+	{ live++; }
+
+	~fragile()
+	{
+		CHECK(live.load() > 0);
+		live--;
+	}
+};
+
+std::atomic<long>	fragile::live(0);
+
+void	throwing_constructors()
+{
+	{
+		ft::concurrent_vector<fragile>	v;
+		std::vector<std::vector<size_t> >	built(threads);
+		std::atomic<long>				thrown(0);
+
+		run_threads(threads, [&](long t) {
+			for (long j = 0; j < per_thread / 10; j++)
+			{
+				try
+				{
+					built[t].push_back(v.emplace_back(encode(t, j)).index());
+				}
+				catch (const std::runtime_error &)
+				{
+					thrown++;
+				}
+			}
+		});
+		CHECK(v.size() == static_cast<size_t>(threads * per_thread / 10));
+		CHECK(thrown.load() == threads * per_thread / 100);
+		CHECK(fragile::live.load() == threads * per_thread / 10 - thrown.load());
+
+		ft::concurrent_vector<fragile>	copy(v);
+		CHECK(copy.size() == v.size());
+		CHECK(fragile::live.load() == 2 * (threads * per_thread / 10 - thrown.load()));
+		for (long t = 0; t < threads; t++)
+		{
+			for (size_t k = 0; k < built[t].size(); k++)
+				CHECK(copy[built[t][k]].value == v[built[t][k]].value);
+		}
+	}
+	CHECK(fragile::live.load() == 0);
+	check::pass("throwing constructors from 4 threads");
+}
+
+int main()
+{
+	check::title("concurrent_vector, 4 threads");
+	push_backs();
+	grow_bys();
+	readers();
+	throwing_constructors();
+	return (0);
+}
+#else
+int main()
+{
+	COUT(B_CYAN, "concurrent_vector needs C++11 (make check17)");
+	return (0);
+}
+#endif
@@ -0,0 +1,124 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   finger.cpp                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** map::lower_bound / upper_bound from an iterator against the plain
+** searches from the root: from every position (begin and end included),
+** for keys before, between, on and after the stored ones, bounds behind
+** from included, through the const overloads too, and along the forward
+** walks they are meant for. merge_sorted, built on them, must end up with
+** what insert gives.
+*/
+
+#include "check.hpp"
+#include "../containers/map.hpp"
+#include <vector>
+
+template<class Map>
+void	every_position(const std::string &name)
+{
+	Map			m;
+	const Map	&cm = m;
+	int			n = 300;
+
+	// even keys: odd ones fall between two
+	for (int i = 0; i < n; i++)
+		m.insert(ft::make_pair(2 * i, i));
+	for (typename Map::iterator from = m.begin(); ; ++from)
+	{
+		typename Map::const_iterator cfrom = from;
+		for (int k = -2; k <= 2 * n + 1; k++)
+		{
+			CHECK(m.lower_bound(from, k) == m.lower_bound(k));
+			CHECK(m.upper_bound(from, k) == m.upper_bound(k));
+			CHECK(cm.lower_bound(cfrom, k) == cm.lower_bound(k));
+			CHECK(cm.upper_bound(cfrom, k) == cm.upper_bound(k));
+		}
+		if (from == m.end())
+			break ;
+	}
+	check::pass(name + " from every position");
+}
+
+template<class Map>
+void	forward_walks(const std::string &name)
+{
+	Map			m;
+	check::rng	rng;
+
+	for (int i = 0; i < 20000; i++)
+		m.insert(ft::make_pair(static_cast<int>(rng.below(100000)), i));
+	for (int walk = 0; walk < 50; walk++)
+	{
+		typename Map::iterator	lower = m.begin();
+		typename Map::iterator	upper = m.begin();
+		int						k = -1;
+		int						step = 1 + static_cast<int>(rng.below(walk * walk + 1));
+
+		while (k <= 100000)
+		{
+			lower = m.lower_bound(lower, k);
+			upper = m.upper_bound(upper, k);
+			CHECK(lower == m.lower_bound(k));
+			CHECK(upper == m.upper_bound(k));
+			k += 1 + static_cast<int>(rng.below(step));
+		}
+	}
+	check::pass(name + " forward walks");
+}
+
+template<class Map>
+void	merged(const std::string &name)
+{
+	check::rng	rng;
+
+	for (int round = 0; round < 20; round++)
+	{
+		Map									merged;
+		Map									inserted;
+		std::vector<ft::pair<int, int> >	batch;
+
+		for (int i = 0; i < 2000; i++)
+		{
+			int k = static_cast<int>(rng.below(10000));
+			merged.insert(ft::make_pair(k, i));
+			inserted.insert(ft::make_pair(k, i));
+		}
+		// sorted, with keys already in the maps and repeated ones
+		for (int k = static_cast<int>(rng.below(7)); k < 10000; k += 1 + static_cast<int>(rng.below(round * 50 + 1)))
+		{
+			batch.push_back(ft::make_pair(k, -k));
+			if (rng.below(4) == 0)
+				batch.push_back(ft::make_pair(k, -k - 1));
+		}
+		merged.merge_sorted(batch.begin(), batch.end());
+		inserted.insert(batch.begin(), batch.end());
+		CHECK(merged == inserted);
+	}
+	check::pass(name + " merge_sorted matches insert");
+}
+
+template<class Map>
+void	run(const std::string &name)
+{
+	check::title(name);
+	every_position<Map>(name);
+	forward_walks<Map>(name);
+	merged<Map>(name);
+}
+
+int main()
+{
+	run<ft::map<int, int> >("map");
+	run<ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, ft::avl_balance> >("avl map");
+	return (0);
+}
@@ -0,0 +1,191 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   map_snapshot.cpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** write_snapshot then map_snapshot: maps of several sizes, the empty one
+** and ones spanning several write chunks, come back equal through load and
+** are found in place. Files with a flipped record byte, a cut tail or a
+** wrong header field are refused with the matching error, and opening
+** without verify skips the checksum only.
+*/
+
+#include "check.hpp"
+#include "../containers/map_snapshot.hpp"
+#include <cstddef>
+#include <cstdio>
+#include <stdexcept>
+
+typedef ft::map<long, double>				map_type;
+typedef ft::map_snapshot<long, double>		snapshot_type;
+typedef ft::map_snapshot<int, int>			int_snapshot_type;
+
+static const char	*path = "/tmp/ft_check_snapshot.bin";
+
+// the constructor throws, with what as its message
+template<class Snapshot>
+bool	rejects(const std::string &what, bool verify = true)
+{
+	try
+	{
+		Snapshot snap(path, verify);
+	}
+	catch (const std::runtime_error &e)
+	{
+		return (what == e.what());
+	}
+	return (false);
+}
+
+// overwrites len bytes of the file at offset
+void	patch(long offset, const void *bytes, size_t len)
+{
+	std::FILE *f = std::fopen(path, "r+b");
+
+	CHECK(f != NULL);
+	CHECK(std::fseek(f, offset, SEEK_SET) == 0);
+	CHECK(std::fwrite(bytes, 1, len, f) == len);
+	std::fclose(f);
+}
+
+// inverts the byte at offset
+void	flip(long offset)
+{
+	std::FILE	*f = std::fopen(path, "r+b");
+	int			c;
+
+	CHECK(f != NULL);
+	CHECK(std::fseek(f, offset, SEEK_SET) == 0 && (c = std::fgetc(f)) != EOF);
+	CHECK(std::fseek(f, offset, SEEK_SET) == 0 && std::fputc(~c & 0xff, f) != EOF);
+	std::fclose(f);
+}
+
+long	file_size()
+{
+	struct stat st;
+
+	CHECK(stat(path, &st) == 0);
+	return (st.st_size);
+}
+
+map_type	random_map(size_t n)
+{
+	check::rng	rng(n + 1);
+	map_type	m;
+
+	while (m.size() < n)
+		m.insert(ft::make_pair(static_cast<long>(rng.next() >> 1), m.size() * 0.5));
+	return (m);
+}
+
+void	round_trips()
+{
+	size_t	sizes[] = { 0, 1, 2, 100, 8192, 8193, 30000 };
+
+	for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+	{
+		map_type	source = random_map(sizes[i]);
+		map_type	loaded;
+
+		loaded.insert(ft::make_pair(-1L, -1.0)); // replaced by the load
+		ft::write_snapshot(source, path);
+		CHECK(file_size() == static_cast<long>(sizeof(ft::snapshot_header)
+			+ sizes[i] * sizeof(snapshot_type::value_type)));
+
+		snapshot_type	snap(path);
+		CHECK(snap.size() == sizes[i] && snap.empty() == (sizes[i] == 0));
+		snap.load(loaded);
+		CHECK(loaded.size() == source.size() && loaded == source);
+		for (map_type::const_iterator it = source.begin(); it != source.end(); it++)
+		{
+			snapshot_type::const_iterator found = snap.find(it->first);
+			CHECK(found != snap.end() && found->second == it->second);
+		}
+		CHECK(snap.find(-1) == snap.end());
+	}
+	check::pass("round trips, empty map and several chunks included");
+}
+
+void	corrupted()
+{
+	map_type	source = random_map(1000);
+	long		record = sizeof(snapshot_type::value_type);
+
+	ft::write_snapshot(source, path);
+	// a flipped byte in the last record
+	flip(file_size() - record + 1);
+	CHECK(rejects<snapshot_type>("map_snapshot: checksum mismatch"));
+	{
+		// not verified: opened as is
+		snapshot_type snap(path, false);
+		CHECK(snap.size() == 1000);
+	}
+	// the stored checksum itself
+	ft::write_snapshot(source, path);
+	uint64_t checksum = 42;
+	patch(offsetof(ft::snapshot_header, checksum), &checksum, sizeof(checksum));
+	CHECK(rejects<snapshot_type>("map_snapshot: checksum mismatch"));
+	check::pass("corrupted checksum rejected");
+}
+
+void	truncated()
+{
+	map_type	source = random_map(1000);
+	long		record = sizeof(snapshot_type::value_type);
+	long		cuts[] = { 1, record, 10 * record + 3 };
+
+	for (size_t i = 0; i < sizeof(cuts) / sizeof(cuts[0]); i++)
+	{
+		ft::write_snapshot(source, path);
+		CHECK(truncate(path, file_size() - cuts[i]) == 0);
+		CHECK(rejects<snapshot_type>("map_snapshot: truncated file", false));
+	}
+	// shorter than the header, and empty
+	CHECK(truncate(path, sizeof(ft::snapshot_header) - 1) == 0);
+	CHECK(rejects<snapshot_type>("map_snapshot: truncated file"));
+	CHECK(truncate(path, 0) == 0);
+	CHECK(rejects<snapshot_type>("map_snapshot: truncated file"));
+	std::remove(path);
+	CHECK(rejects<snapshot_type>("map_snapshot: cannot open file"));
+	check::pass("truncated file rejected");
+}
+
+void	wrong_header()
+{
+	map_type	source = random_map(100);
+	uint32_t	version = ft::snapshot_version + 1;
+	uint32_t	record_size = 4;
+
+	ft::write_snapshot(source, path);
+	patch(0, "FTMAPSNQ", 8);
+	CHECK(rejects<snapshot_type>("map_snapshot: not a snapshot"));
+	ft::write_snapshot(source, path);
+	patch(offsetof(ft::snapshot_header, version), &version, sizeof(version));
+	CHECK(rejects<snapshot_type>("map_snapshot: unsupported version"));
+	ft::write_snapshot(source, path);
+	patch(offsetof(ft::snapshot_header, record_size), &record_size, sizeof(record_size));
+	CHECK(rejects<snapshot_type>("map_snapshot: record size mismatch"));
+	// opened with other record types
+	ft::write_snapshot(source, path);
+	CHECK(rejects<int_snapshot_type>("map_snapshot: record size mismatch"));
+	check::pass("wrong header rejected");
+}
+
+int main()
+{
+	check::title("map_snapshot");
+	round_trips();
+	corrupted();
+	truncated();
+	wrong_header();
+	std::remove(path);
+	return (0);
+}
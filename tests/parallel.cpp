@@ -0,0 +1,311 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parallel.cpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** thread_pool, task_group and the parallel algorithms against the
+** sequential loops, on pools of 0, 1 and 4 workers and on sizes on both
+** sides of parallel_grain. Reductions use an associative operation that
+** does not commute, so pieces combined out of order show. A task throwing
+** has its exception rethrown by wait() once the other tasks are done, and
+** groups waited for from inside tasks, nested a few levels deep, finish
+** even on a pool with no worker.
+*/
+
+#include "check.hpp"
+
+#if __cplusplus >= 201103L
+# include <atomic>
+# include <stdexcept>
+# include "../containers/vector.hpp"
+# include "../containers/map.hpp"
+# include "../utils/parallel.hpp"
+
+typedef unsigned long								number;
+typedef ft::pair<number, number>					affine; // x -> x * first + second
+typedef ft::map<number, number>						map_type;
+
+static const size_t		workers[] = { 0, 1, 4 };
+static const size_t		grain = ft::parallel_grain;
+static const size_t		sizes[] = { 0, 1, 100, grain - 1, grain, grain + 1, 10 * grain + 7 };
+
+// applies a then b: associative, not commutative
+affine	compose(const affine &a, const affine &b)
+{ return (affine(a.first * b.first, a.second * b.first + b.second)); }
+
+affine	to_affine(number x)
+{ return (affine(x | 1, x)); }
+
+number	work(number x)
+{ return (x * 3 + 1); }
+
+/*
+** RANDOM ACCESS RANGES
+*/
+
+void	ranges(ft::thread_pool &pool)
+{
+	for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+	{
+		size_t				n = sizes[s];
+		check::rng			rng(n + 1);
+		ft::vector<number>	v(n);
+		ft::vector<number>	out(n + 1, 0);
+
+		for (size_t i = 0; i < n; i++)
+			v[i] = rng.next();
+		ft::vector<number>	expected(v);
+
+		// each element visited exactly once
+		for (size_t i = 0; i < n; i++)
+			expected[i] = work(expected[i]);
+		ft::parallel_for_each(v.begin(), v.end(), [](number &x) { x = work(x); }, pool);
+		CHECK(v == expected);
+
+		CHECK(ft::parallel_transform(v.begin(), v.end(), out.begin(), work, pool) == out.begin() + n);
+		for (size_t i = 0; i < n; i++)
+			CHECK(out[i] == work(v[i]));
+		CHECK(out[n] == 0);
+
+		number	sum = 7;
+		affine	chain(1, 0);
+		for (size_t i = 0; i < n; i++)
+		{
+			sum += v[i];
+			chain = compose(chain, to_affine(v[i]));
+		}
+		CHECK(ft::parallel_reduce(v.begin(), v.end(), static_cast<number>(7)) == sum);
+		CHECK(ft::parallel_transform_reduce(v.begin(), v.end(), affine(1, 0), compose, to_affine, pool)
+			== chain);
+		ft::vector<affine>	affines(n);
+		for (size_t i = 0; i < n; i++)
+			affines[i] = to_affine(v[i]);
+		CHECK(ft::parallel_reduce(affines.begin(), affines.end(), affine(1, 0), compose, pool) == chain);
+	}
+}
+
+/*
+** MAPS
+*/
+
+void	maps(ft::thread_pool &pool)
+{
+	for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+	{
+		size_t				n = sizes[s];
+		check::rng			rng(n + 2);
+		map_type			m;
+		ft::vector<number>	out(n + 1, 0);
+
+		while (m.size() < n)
+			m.insert(ft::make_pair(rng.next() | 1, rng.next())); // odd: products never reach 0
+		map_type	expected(m);
+
+		for (map_type::iterator it = expected.begin(); it != expected.end(); it++)
+			it->second = work(it->second);
+		ft::parallel_for_each(m, [](map_type::value_type &p) { p.second = work(p.second); }, pool);
+		CHECK(m == expected);
+
+		CHECK(ft::parallel_transform(m, out.begin(),
+			[](const map_type::value_type &p) { return (p.first ^ p.second); }, pool) == out.begin() + n);
+		size_t	i = 0;
+		for (map_type::const_iterator it = m.begin(); it != m.end(); it++, i++)
+			CHECK(out[i] == (it->first ^ it->second));
+		CHECK(out[n] == 0);
+
+		affine	keys(1, 0);
+		affine	values(1, 0);
+		for (map_type::const_iterator it = m.begin(); it != m.end(); it++)
+		{
+			keys = compose(keys, *it);
+			values = compose(values, to_affine(it->second));
+		}
+		// the elements themselves, as pairs
+		CHECK(ft::parallel_reduce(m, affine(1, 0), compose, pool) == keys);
+		CHECK(ft::parallel_transform_reduce(m, affine(1, 0), compose,
+			[](const map_type::value_type &p) { return (to_affine(p.second)); }, pool) == values);
+	}
+}
+
+/*
+** TASK GROUPS
+*/
+
+void	exceptions(ft::thread_pool &pool)
+{
+	std::atomic<long>	done(0);
+
+	{
+		ft::task_group	group(pool);
+		for (long i = 0; i < 100; i++)
+		{
+			group.run([&done, i]() {
+				if (i == 37)
+					throw std::runtime_error("task 37");
+				done++;
+			});
+		}
+		try
+		{
+			group.wait();
+			CHECK(false);
+		}
+		catch (const std::runtime_error &e)
+		{
+			CHECK(std::string(e.what()) == "task 37");
+		}
+		// every other task ran, and the error is only reported once
+		CHECK(done == 99);
+		group.run([&done]() { done++; });
+		group.wait();
+		CHECK(done == 100);
+	}
+	{
+		// a group dropped with a failed task swallows the error
+		ft::task_group	group(pool);
+		group.run([]() { throw std::logic_error("dropped"); });
+	}
+	// through the algorithms
+	ft::vector<number>	v(10 * grain, 1);
+	map_type			m;
+	for (number k = 0; k < 3 * grain; k++)
+		m.insert(ft::make_pair(k, k));
+	number				*bad = &v[v.size() / 2 + 3];
+	try
+	{
+		ft::parallel_for_each(v.begin(), v.end(), [bad](number &x) {
+			if (&x == bad)
+				throw std::out_of_range("element");
+		}, pool);
+		CHECK(false);
+	}
+	catch (const std::out_of_range &e)
+	{
+		CHECK(std::string(e.what()) == "element");
+	}
+	try
+	{
+		ft::parallel_for_each(m, [](map_type::value_type &p) {
+			if (p.first == 2 * grain)
+				throw std::out_of_range("node");
+		}, pool);
+		CHECK(false);
+	}
+	catch (const std::out_of_range &e)
+	{
+		CHECK(std::string(e.what()) == "node");
+	}
+}
+
+// nested_sum calls live on the calling thread's stack, and the most seen
+thread_local long	depth = 0;
+std::atomic<long>	max_depth(0);
+
+// sums [first, last) by splitting it in halves, each one a task, down to
+// ranges of 16
+number	nested_sum(ft::thread_pool &pool, number first, number last, std::atomic<long> &groups)
+{
+	struct frame
+	{
+		frame()
+		{
+			long seen = max_depth.load();
+			depth++;
+			while (depth > seen && !max_depth.compare_exchange_weak(seen, depth))
+				;
+		}
+		~frame() { depth--; }
+	}	guard;
+
+	if (last - first <= 16)
+	{
+		number sum = 0;
+		for (; first < last; first++)
+			sum += first;
+		return (sum);
+	}
+	number			mid = first + (last - first) / 2;
+	number			left;
+	number			right;
+	ft::task_group	group(pool);
+
+	groups++;
+	group.run([&]() { left = nested_sum(pool, first, mid, groups); });
+	group.run([&]() { right = nested_sum(pool, mid, last, groups); });
+	group.wait();
+	return (left + right);
+}
+
+void	nested(ft::thread_pool &pool)
+{
+	std::atomic<long>	groups(0);
+	number				n = 100000;
+
+	max_depth = 0;
+	CHECK(nested_sum(pool, 0, n, groups) == n * (n - 1) / 2);
+	CHECK(groups > 1000);
+	// waiting runs the newest tasks first, the stack follows the nesting
+	// (13 levels here), not the thousands of tasks
+	CHECK(max_depth < 100);
+
+	// a parallel algorithm inside the tasks of another one
+	ft::vector<ft::vector<number> >	rows(8, ft::vector<number>(2 * grain, 1));
+	ft::parallel_for_each(rows.begin(), rows.end(), [&pool](ft::vector<number> &row) {
+		ft::parallel_for_each(row.begin(), row.end(), [](number &x) { x = work(x); }, pool);
+	}, pool);
+	for (size_t r = 0; r < rows.size(); r++)
+		CHECK(ft::parallel_reduce(rows[r].begin(), rows[r].end(), static_cast<number>(0)) == 4 * 2 * grain);
+
+	// an inner failure goes up through every wait
+	try
+	{
+		ft::task_group	outer(pool);
+		outer.run([&pool]() {
+			ft::task_group inner(pool);
+			inner.run([]() { throw std::runtime_error("inner"); });
+			inner.wait();
+		});
+		outer.wait();
+		CHECK(false);
+	}
+	catch (const std::runtime_error &e)
+	{
+		CHECK(std::string(e.what()) == "inner");
+	}
+}
+
+int main()
+{
+	check::title("parallel algorithms against sequential loops");
+	for (size_t w = 0; w < sizeof(workers) / sizeof(workers[0]); w++)
+	{
+		ft::thread_pool	pool(workers[w]);
+		std::string		name = std::to_string(workers[w]) + " workers";
+
+		CHECK(pool.size() == workers[w]);
+		ranges(pool);
+		check::pass(name + ": for_each, transform and reduce on ranges");
+		maps(pool);
+		check::pass(name + ": for_each, transform and reduce on maps");
+		exceptions(pool);
+		check::pass(name + ": exceptions rethrown by wait");
+		nested(pool);
+		check::pass(name + ": nested groups");
+	}
+	return (0);
+}
+#else
+int main()
+{
+	COUT(B_CYAN, "parallel needs C++11 (make check17)");
+	return (0);
+}
+#endif
@@ -0,0 +1,204 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   simd.cpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** The SIMD kernels against plain loops written here, at every level the
+** CPU has: find, count, min, max and sum on every length from 0 to 70 and
+** every start offset within a vector register, so each tail and unaligned
+** load is taken. Values are drawn from a small set so matches and ties are
+** common; floats include NaN, -0.0 and infinities, ints the extremes and
+** sums that wrap around.
+*/
+
+#include "check.hpp"
+#include "../utils/simd.hpp"
+#include "../utils/algorithm.hpp"
+#include "../containers/vector.hpp"
+#include <limits>
+#include <vector>
+
+static const size_t	max_length = 70;
+static const size_t	max_offset = 8;
+
+/*
+** REFERENCES
+*/
+
+template<class T>
+size_t	ref_find(const T *a, size_t n, T v)
+{
+	for (size_t i = 0; i < n; i++)
+	{
+		if (a[i] == v)
+			return (i);
+	}
+	return (n);
+}
+
+template<class T>
+size_t	ref_count(const T *a, size_t n, T v)
+{
+	size_t c = 0;
+	for (size_t i = 0; i < n; i++)
+	{
+		if (a[i] == v)
+			c++;
+	}
+	return (c);
+}
+
+// first smallest (Max: first largest), as std::min_element finds it
+template<bool Max, class T>
+size_t	ref_extremum(const T *a, size_t n)
+{
+	size_t best = 0;
+	for (size_t i = 1; i < n; i++)
+	{
+		if (Max ? a[best] < a[i] : a[i] < a[best])
+			best = i;
+	}
+	return (best);
+}
+
+int	ref_sum(const int *a, size_t n)
+{
+	unsigned int s = 0;
+	for (size_t i = 0; i < n; i++)
+		s += static_cast<unsigned int>(a[i]);
+	return (static_cast<int>(s));
+}
+
+/*
+** VALUES
+*/
+
+int	pick(check::rng &rng, int)
+{
+	static const int	pool[] = { 0, 1, -1, 7, 42, -42,
+		std::numeric_limits<int>::max(), std::numeric_limits<int>::min() };
+
+	return (pool[rng.below(sizeof(pool) / sizeof(pool[0]))]);
+}
+
+float	pick(check::rng &rng, float)
+{
+	static const float	pool[] = { 0.0f, -0.0f, 1.5f, -2.0f, 7.0f,
+		std::numeric_limits<float>::quiet_NaN(),
+		std::numeric_limits<float>::infinity(),
+		-std::numeric_limits<float>::infinity() };
+
+	return (pool[rng.below(sizeof(pool) / sizeof(pool[0]))]);
+}
+
+template<class T>
+void	kernels(check::rng &rng)
+{
+	std::vector<T>	buffer(max_length + max_offset);
+
+	for (size_t round = 0; round < 20; round++)
+	{
+		for (size_t i = 0; i < buffer.size(); i++)
+			buffer[i] = pick(rng, T());
+		for (size_t offset = 0; offset < max_offset; offset++)
+		{
+			for (size_t n = 0; n <= max_length; n++)
+			{
+				const T	*a = &buffer[offset];
+				T		v = pick(rng, T());
+
+				CHECK(ft::simd::find(a, n, v) == ref_find(a, n, v));
+				CHECK(ft::simd::count(a, n, v) == ref_count(a, n, v));
+				CHECK(ft::simd::extremum<false>(a, n) == ref_extremum<false>(a, n));
+				CHECK(ft::simd::extremum<true>(a, n) == ref_extremum<true>(a, n));
+				if (n > 0)
+				{
+					// the needle present, on its last occurrence only
+					T last = a[n - 1];
+					CHECK(ft::simd::find(a, n, last) == ref_find(a, n, last));
+					CHECK(ft::simd::count(a, n, last) == ref_count(a, n, last));
+				}
+			}
+		}
+	}
+}
+
+void	sums(check::rng &rng)
+{
+	std::vector<int>	buffer(max_length + max_offset);
+
+	for (size_t round = 0; round < 20; round++)
+	{
+		for (size_t i = 0; i < buffer.size(); i++)
+			buffer[i] = pick(rng, int()) + static_cast<int>(rng.below(1000));
+		for (size_t offset = 0; offset < max_offset; offset++)
+		{
+			for (size_t n = 0; n <= max_length; n++)
+				CHECK(ft::simd::sum(&buffer[offset], n) == ref_sum(&buffer[offset], n));
+		}
+	}
+}
+
+// count keeps per-lane counters, flushed every 2^20 elements
+void	long_counts()
+{
+	std::vector<int>	ints(3 * (1 << 20) + 5, 3);
+	std::vector<float>	floats(ints.size(), 3.0f);
+
+	ints[1 << 20] = 4;
+	floats.back() = 4.0f;
+	CHECK(ft::simd::count(&ints[0], ints.size(), 3) == ints.size() - 1);
+	CHECK(ft::simd::count(&floats[0], floats.size(), 3.0f) == floats.size() - 1);
+	CHECK(ft::simd::find(&ints[0], ints.size(), 4) == 1 << 20);
+	CHECK(ft::simd::extremum<true>(&floats[0], floats.size()) == floats.size() - 1);
+}
+
+// the algorithm.hpp overloads that dispatch to the kernels
+void	algorithms()
+{
+	ft::vector<int>		v;
+
+	for (int i = 0; i < 100; i++)
+		v.push_back((i * 37) % 101);
+	CHECK(ft::find(v.begin(), v.end(), 5) - v.begin() == static_cast<long>(ref_find(&v[0], 100, 5)));
+	CHECK(ft::count(v.begin(), v.end(), 5) == static_cast<long>(ref_count(&v[0], 100, 5)));
+	CHECK(ft::min_element(v.begin(), v.end()) - v.begin() == static_cast<long>(ref_extremum<false>(&v[0], 100)));
+	CHECK(ft::max_element(v.begin(), v.end()) - v.begin() == static_cast<long>(ref_extremum<true>(&v[0], 100)));
+	CHECK(ft::accumulate(v.begin(), v.end(), 10) == 10 + ref_sum(&v[0], 100));
+}
+
+int main()
+{
+	const char			*names[] = { "scalar", "SSE4.1", "AVX2" };
+	ft::simd::isa		levels[] = { ft::simd::SCALAR, ft::simd::SSE41, ft::simd::AVX2 };
+	ft::simd::isa		cpu = ft::simd::level();
+
+	check::title("simd kernels against plain loops");
+	for (size_t l = 0; l < 3; l++)
+	{
+		check::rng	rng(l + 1);
+
+		ft::simd::set_level(levels[l]);
+		if (ft::simd::level() != levels[l])
+		{
+			COUT(B_CYAN, "    " << names[l] << " not available on this CPU");
+			continue ;
+		}
+		kernels<int>(rng);
+		kernels<float>(rng);
+		sums(rng);
+		long_counts();
+		algorithms();
+		check::pass(std::string(names[l]) + " find, count, min, max and sum");
+	}
+	ft::simd::set_level(cpu);
+	return (0);
+}
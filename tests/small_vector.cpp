@@ -0,0 +1,456 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   small_vector.cpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** small_vector across the inline / heap boundary: where the elements live
+** as it spills and shrinks back, copies, moves and the four kinds of swap,
+** then random operations around N checked against a std::vector after
+** each one. Elements count their live instances and the allocator its
+** blocks: none may leak or be freed twice, a copy that throws mid-spill
+** included. A moved heap block goes back to the allocator it came from,
+** and over-aligned elements get aligned inline slots.
+*/
+
+#include "check.hpp"
+#include "../containers/small_vector.hpp"
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+// counts its live instances; the copy throws once throw_in reaches 0
+struct tracked
+{
+	static long	live;
+	static long	throw_in;
+	int			value;
+
+	tracked(int v = 0) : value(v)
+	{ live++; }
+
+	tracked(const tracked &x) : value(x.value)
+	{
+		if (throw_in > 0 && --throw_in == 0)
+			throw std::runtime_error("tracked copy");
+		live++;
+	}
+
+	tracked &operator=(const tracked &x)
+	{
+		value = x.value;
+		return (*this);
+	}
+
+	~tracked()
+	{
+		CHECK(live > 0);
+		live--;
+	}
+
+	bool operator==(const tracked &x) const
+	{ return (value == x.value); }
+};
+
+long	tracked::live = 0;
+long	tracked::throw_in = 0;
+
+// counts the heap blocks it has out
+template<class T>
+struct counting_allocator : std::allocator<T>
+{
+	static long	blocks;
+
+	template<class U>
+	struct rebind
+	{ typedef counting_allocator<U> other; };
+
+	counting_allocator() {}
+
+	template<class U>
+	counting_allocator(const counting_allocator<U> &) {}
+
+	T *allocate(size_t n)
+	{
+		T *mem = std::allocator<T>::allocate(n);
+		blocks++;
+		return (mem);
+	}
+
+	void deallocate(T *mem, size_t n)
+	{
+		CHECK(blocks > 0);
+		blocks--;
+		std::allocator<T>::deallocate(mem, n);
+	}
+};
+
+template<class T>
+long	counting_allocator<T>::blocks = 0;
+
+static const size_t												N = 4;
+typedef ft::small_vector<tracked, N, counting_allocator<tracked> >	small;
+typedef std::vector<tracked>										model;
+
+// nothing left behind once every vector is gone
+bool	clean()
+{ return (tracked::live == 0 && counting_allocator<tracked>::blocks == 0); }
+
+bool	same(const small &v, const model &m)
+{
+	if (v.size() != m.size() || v.capacity() < v.size())
+		return (false);
+	for (size_t i = 0; i < m.size(); i++)
+	{
+		if (!(v[i] == m[i]))
+			return (false);
+	}
+	return (true);
+}
+
+void	spill_and_shrink()
+{
+	{
+		small	v;
+		model	m;
+
+		for (int i = 0; i < static_cast<int>(N); i++)
+		{
+			v.push_back(i);
+			m.push_back(i);
+			CHECK(v.is_inline() && v.capacity() == N);
+		}
+		v.push_back(static_cast<int>(N));
+		m.push_back(static_cast<int>(N));
+		CHECK(!v.is_inline() && v.capacity() > N && same(v, m));
+		// shrinking keeps the heap block
+		while (v.size() > 1)
+		{
+			v.pop_back();
+			m.pop_back();
+			CHECK(!v.is_inline() && same(v, m));
+		}
+		// a copy that fits comes back inline, a big one spills
+		small	shrunk(v);
+		CHECK(shrunk.is_inline() && same(shrunk, m));
+		v.insert(v.end(), 10, tracked(7));
+		m.insert(m.end(), 10, tracked(7));
+		small	copy(v);
+		CHECK(!copy.is_inline() && same(copy, m));
+		copy = shrunk;
+		CHECK(same(copy, model(1, tracked(0))));
+		// reserve within N stays inline
+		small	r;
+		r.reserve(N);
+		CHECK(r.is_inline());
+		r.reserve(N + 1);
+		CHECK(!r.is_inline() && r.capacity() >= N + 1);
+		v.clear();
+		CHECK(v.empty() && !v.is_inline());
+	}
+	CHECK(clean());
+	check::pass("spill and shrink");
+}
+
+void	swaps()
+{
+	{
+		model	a_ref(2, tracked(1));
+		model	b_ref(N + 3, tracked(2));
+		small	a(a_ref.begin(), a_ref.end());
+		small	b(b_ref.begin(), b_ref.end());
+		small	c(a_ref.begin(), a_ref.end());
+		small	d(b_ref.begin(), b_ref.end());
+
+		CHECK(a.is_inline() && !b.is_inline());
+		// inline with heap, both ways
+		a.swap(b);
+		CHECK(!a.is_inline() && same(a, b_ref) && b.is_inline() && same(b, a_ref));
+		a.swap(b);
+		CHECK(a.is_inline() && same(a, a_ref) && !b.is_inline() && same(b, b_ref));
+		// inline with inline, heap with heap
+		small	e(N, tracked(3));
+		a.swap(e);
+		CHECK(same(a, model(N, tracked(3))) && same(e, a_ref));
+		b.swap(d);
+		CHECK(same(b, b_ref) && same(d, b_ref));
+		ft::swap(c, d);
+		CHECK(same(c, b_ref) && same(d, a_ref));
+		c.swap(c);
+		CHECK(same(c, b_ref));
+#if __cplusplus >= 201103L
+		// moves steal a heap block, relocate inline elements
+		small	f(std::move(c));
+		CHECK(same(f, b_ref) && c.empty() && c.is_inline());
+		small	g(std::move(d));
+		CHECK(same(g, a_ref) && d.empty());
+		g = std::move(f);
+		CHECK(same(g, b_ref) && f.empty() && f.is_inline());
+#endif
+	}
+	CHECK(clean());
+	check::pass("swaps and moves");
+}
+
+void	random_ops()
+{
+	{
+		check::rng	rng;
+		small		v;
+		model		m;
+		small		other;
+		model		other_ref;
+
+		for (int op = 0; op < 50000; op++)
+		{
+			size_t	pos = rng.below(m.size() + 1);
+			size_t	n = rng.below(N + 2);
+			int		val = static_cast<int>(rng.below(1000));
+
+			switch (rng.below(9))
+			{
+				case 0:
+					v.push_back(val);
+					m.push_back(val);
+					break ;
+				case 1:
+					if (!m.empty())
+					{
+						v.pop_back();
+						m.pop_back();
+					}
+					break ;
+				case 2:
+					v.insert(v.begin() + pos, val);
+					m.insert(m.begin() + pos, val);
+					break ;
+				case 3:
+					v.insert(v.begin() + pos, n, tracked(val));
+					m.insert(m.begin() + pos, n, tracked(val));
+					break ;
+				case 4:
+				{
+					// an element of the vector itself
+					if (m.empty())
+						break ;
+					size_t from = rng.below(m.size());
+					tracked copy(m[from]);
+					v.insert(v.begin() + pos, v[from]);
+					m.insert(m.begin() + pos, copy);
+					break ;
+				}
+				case 5:
+				{
+					size_t last = pos + rng.below(m.size() - pos + 1);
+					v.erase(v.begin() + pos, v.begin() + last);
+					m.erase(m.begin() + pos, m.begin() + last);
+					break ;
+				}
+				case 6:
+					v.resize(rng.below(3 * N), tracked(val));
+					m.resize(v.size(), tracked(val));
+					break ;
+				case 7:
+					v.swap(other);
+					m.swap(other_ref);
+					CHECK(same(other, other_ref));
+					break ;
+				default:
+					if (rng.below(8) == 0)
+					{
+						v.assign(n, tracked(val));
+						m.assign(n, tracked(val));
+					}
+					else
+					{
+						small copy(v);
+						v = copy;
+					}
+			}
+			CHECK(same(v, m));
+			// a whole heap block is never given back to inline storage
+			CHECK(v.is_inline() == (v.capacity() == N));
+			if (m.size() > 3 * N)
+			{
+				v.erase(v.begin(), v.begin() + N);
+				m.erase(m.begin(), m.begin() + N);
+			}
+		}
+	}
+	CHECK(clean());
+	check::pass("random operations against std::vector");
+}
+
+// a copy throwing at each possible point of a spilling insert
+void	throwing_copies()
+{
+	for (long at = 1; at < 20; at++)
+	{
+		{
+			small	v;
+
+			for (int i = 0; i < static_cast<int>(N); i++)
+				v.push_back(i);
+			tracked::throw_in = at;
+			try
+			{
+				v.insert(v.begin() + 1, 3, tracked(9));
+				tracked::throw_in = 0;
+				CHECK(v.size() == N + 3 && v[1] == tracked(9) && v[N + 2] == tracked(N - 1));
+			}
+			catch (const std::runtime_error &)
+			{
+				tracked::throw_in = 0;
+				CHECK(v.size() <= N + 3 && v.capacity() >= v.size());
+			}
+			tracked::throw_in = at;
+			try
+			{
+				small copy(v);
+				tracked::throw_in = 0;
+				CHECK(copy.size() == v.size());
+			}
+			catch (const std::runtime_error &)
+			{
+				tracked::throw_in = 0;
+			}
+		}
+		CHECK(clean());
+	}
+	check::pass("throwing copies");
+}
+
+// an allocator with an identity: a block must go back to its owner
+template<class T>
+struct owned_allocator : std::allocator<T>
+{
+	static std::map<void *, int>	owners;
+	int								id;
+
+	template<class U>
+	struct rebind
+	{ typedef owned_allocator<U> other; };
+
+	owned_allocator(int i = 0) : id(i) {}
+
+	template<class U>
+	owned_allocator(const owned_allocator<U> &x) : id(x.id) {}
+
+	T *allocate(size_t n)
+	{
+		T *mem = std::allocator<T>::allocate(n);
+		owners[mem] = this->id;
+		return (mem);
+	}
+
+	void deallocate(T *mem, size_t n)
+	{
+		CHECK(owners.count(mem) && owners[mem] == this->id);
+		owners.erase(mem);
+		std::allocator<T>::deallocate(mem, n);
+	}
+};
+
+template<class T>
+std::map<void *, int>	owned_allocator<T>::owners;
+
+template<class T, class U>
+bool	operator==(const owned_allocator<T> &x, const owned_allocator<U> &y)
+{ return (x.id == y.id); }
+
+template<class T, class U>
+bool	operator!=(const owned_allocator<T> &x, const owned_allocator<U> &y)
+{ return (x.id != y.id); }
+
+void	stateful_allocators()
+{
+	typedef ft::small_vector<int, N, owned_allocator<int> >	owned;
+
+	{
+		owned	a((owned_allocator<int>(1)));
+		owned	b((owned_allocator<int>(2)));
+
+		for (int i = 0; i < 20; i++)
+		{
+			a.push_back(i);
+			b.push_back(-i);
+		}
+		a.swap(b);
+		CHECK(a.get_allocator().id == 2 && b.get_allocator().id == 1);
+		CHECK(a[19] == -19 && b[19] == 19);
+		// grown by the allocator that came with the block
+		a.insert(a.end(), 100, 7);
+		b.insert(b.end(), 100, 7);
+#if __cplusplus >= 201103L
+		owned	c((owned_allocator<int>(3)));
+		c.push_back(1);
+		c = std::move(a);
+		CHECK(c.get_allocator().id == 2 && c.size() == 120 && c[19] == -19);
+		c.insert(c.end(), 100, 8);
+		owned	d(std::move(b));
+		CHECK(d.get_allocator().id == 1 && d.size() == 120);
+		d.insert(d.end(), 100, 8);
+		// an inline rhs leaves its elements, not a block
+		owned	e((owned_allocator<int>(4)));
+		e.push_back(5);
+		d = std::move(e);
+		CHECK(d.is_inline() && d.size() == 1 && d[0] == 5);
+		d.insert(d.end(), 100, 8);
+#endif
+	}
+	CHECK(owned_allocator<int>::owners.empty());
+	check::pass("blocks freed by their own allocator");
+}
+
+#if __cplusplus >= 201103L
+struct alignas(32) wide
+{
+	double	lanes[4];
+
+	wide(double x = 0) : lanes{x, x, x, x} {}
+};
+
+// a char before the vector puts it on a badly aligned offset
+struct offset
+{
+	char							c;
+	ft::small_vector<wide, 3>		v;
+};
+
+void	over_aligned()
+{
+	offset	o[3];
+
+	for (size_t i = 0; i < 3; i++)
+	{
+		for (int k = 0; k < 3; k++)
+		{
+			o[i].v.push_back(wide(k));
+			CHECK(reinterpret_cast<size_t>(&o[i].v[k]) % alignof(wide) == 0);
+		}
+		CHECK(o[i].v.is_inline());
+	}
+	check::pass("over-aligned elements inline");
+}
+#endif
+
+int main()
+{
+	check::title("small_vector<T, 4>");
+	spill_and_shrink();
+	swaps();
+	random_ops();
+	throwing_copies();
+	stateful_allocators();
+#if __cplusplus >= 201103L
+	over_aligned();
+#endif
+	return (0);
+}
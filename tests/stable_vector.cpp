@@ -0,0 +1,225 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stable_vector.cpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/*
+** stable_vector growing inside its reservation: every element keeps the
+** address it was built at through push_back, resize and shrink_to_fit,
+** the committed part grows in whole pages and stops at the reservation,
+** and shrinking gives pages back without moving anything. Elements count
+** their live instances: a constructor throwing in resize or in a copy
+** leaves nothing behind.
+*/
+
+#include "check.hpp"
+#include "../containers/stable_vector.hpp"
+#include <stdexcept>
+#include <vector>
+
+// counts its live instances; the copy throws once throw_in reaches 0
+struct tracked
+{
+	static long	live;
+	static long	throw_in;
+	long		value;
+
+	tracked(long v = 0) : value(v)
+	{ live++; }
+
+	tracked(const tracked &x) : value(x.value)
+	{
+		if (throw_in > 0 && --throw_in == 0)
+			throw std::runtime_error("tracked copy");
+		live++;
+	}
+
+	tracked &operator=(const tracked &x)
+	{
+		value = x.value;
+		return (*this);
+	}
+
+	~tracked()
+	{
+		CHECK(live > 0);
+		live--;
+	}
+};
+
+long	tracked::live = 0;
+long	tracked::throw_in = 0;
+
+typedef ft::stable_vector<long>		longs;
+
+size_t	page()
+{ return (sysconf(_SC_PAGESIZE)); }
+
+bool	counts_up(const longs &v, size_t n)
+{
+	if (v.size() != n)
+		return (false);
+	for (size_t i = 0; i < n; i++)
+	{
+		if (v[i] != static_cast<long>(i))
+			return (false);
+	}
+	return (true);
+}
+
+void	pointer_stability()
+{
+	longs				v;
+	std::vector<long *>	addresses;
+	size_t				n = 300000;
+
+	CHECK(v.capacity() == 0 && v.max_size() * sizeof(long) == longs::default_reservation);
+	for (size_t i = 0; i < n; i++)
+	{
+		v.push_back(static_cast<long>(i));
+		addresses.push_back(&v.back());
+		// committed in whole pages, never past the reservation
+		CHECK(v.capacity() >= v.size() && v.capacity() * sizeof(long) % page() == 0);
+	}
+	CHECK(counts_up(v, n));
+	for (size_t i = 0; i < n; i++)
+		CHECK(&v[i] == addresses[i]);
+	// resize and shrink_to_fit keep them too
+	v.resize(n / 2);
+	v.shrink_to_fit();
+	CHECK(v.capacity() * sizeof(long) == (n / 2 * sizeof(long) + page() - 1) / page() * page());
+	v.resize(n, -1);
+	for (size_t i = 0; i < n; i++)
+		CHECK(&v[i] == addresses[i] && v[i] == (i < n / 2 ? static_cast<long>(i) : -1));
+	v.clear();
+	v.shrink_to_fit();
+	CHECK(v.empty() && v.capacity() == 0);
+	v.push_back(7);
+	CHECK(&v[0] == addresses[0] && v[0] == 7);
+	check::pass("addresses stable through growth and shrinking");
+}
+
+void	reservations()
+{
+	size_t	max = page() / sizeof(long) * 3;
+	longs	v(max);
+
+	CHECK(v.max_size() == max && v.capacity() == 0);
+	for (size_t i = 0; i < max; i++)
+		v.push_back(static_cast<long>(i));
+	CHECK(v.capacity() == max && counts_up(v, max));
+	// the reservation is the hard limit
+	try
+	{
+		v.push_back(0);
+		CHECK(false);
+	}
+	catch (const std::length_error &)
+	{
+	}
+	CHECK(counts_up(v, max));
+	try
+	{
+		v.reserve_address_space(10 * max);
+		CHECK(false);
+	}
+	catch (const std::logic_error &)
+	{
+	}
+	v.clear();
+	v.reserve_address_space(10 * max);
+	CHECK(v.max_size() == 10 * max && v.capacity() == 0);
+	// a partial page rounds up
+	longs	odd(1);
+	CHECK(odd.max_size() == page() / sizeof(long));
+	check::pass("explicit reservations and their limit");
+}
+
+void	copies_and_swaps()
+{
+	longs	a(100000);
+	longs	b;
+
+	for (size_t i = 0; i < 1000; i++)
+		a.push_back(static_cast<long>(i));
+	longs	copy(a);
+	CHECK(copy == a && copy.max_size() == a.max_size() && &copy[0] != &a[0]);
+	b = a;
+	CHECK(b == a);
+	b.push_back(1000);
+	CHECK(b != a && counts_up(b, 1001));
+
+	long	*first = &a[0];
+	a.swap(b);
+	CHECK(&b[0] == first && counts_up(a, 1001) && counts_up(b, 1000));
+#if __cplusplus >= 201103L
+	longs	moved(std::move(b));
+	CHECK(&moved[0] == first && b.empty() && b.capacity() == 0);
+	b = std::move(moved);
+	CHECK(&b[0] == first && moved.empty());
+	// a moved-from vector grows again
+	moved.push_back(0);
+	CHECK(counts_up(moved, 1));
+	ft::stable_vector<std::vector<int> >	nested;
+	nested.emplace_back(3, 7);
+	CHECK(nested.size() == 1 && nested[0].size() == 3 && nested[0][2] == 7);
+#endif
+	check::pass("copies, swaps and moves");
+}
+
+void	throwing_constructors()
+{
+	for (long at = 1; at < 12; at++)
+	{
+		{
+			ft::stable_vector<tracked>	v;
+
+			for (long i = 0; i < 5; i++)
+				v.push_back(tracked(i));
+			tracked::throw_in = at;
+			try
+			{
+				v.resize(15, tracked(9));
+				tracked::throw_in = 0;
+				CHECK(v.size() == 15 && v[14].value == 9);
+			}
+			catch (const std::runtime_error &)
+			{
+				tracked::throw_in = 0;
+				// nothing half built is left behind
+				CHECK(v.size() == 5 && tracked::live == 5);
+			}
+			tracked::throw_in = at;
+			try
+			{
+				ft::stable_vector<tracked> copy(v);
+				tracked::throw_in = 0;
+				CHECK(copy.size() == v.size());
+			}
+			catch (const std::runtime_error &)
+			{
+				tracked::throw_in = 0;
+			}
+			CHECK(tracked::live == static_cast<long>(v.size()));
+		}
+		CHECK(tracked::live == 0);
+	}
+	check::pass("throwing constructors in resize and copies");
+}
+
+int main()
+{
+	check::title("stable_vector");
+	pointer_stability();
+	reservations();
+	copies_and_swaps();
+	throwing_constructors();
+	return (0);
+}
@@ -16,19 +16,24 @@
 #include "node.hpp"
 #include "pair.hpp"
 #include "enums.hpp"
+#include "balance.hpp"
+#include "hardening.hpp"
+#include "memory.hpp"
+#include "thread_pool.hpp"
 #include <sstream>
 
 namespace ft
 {
 
 	template<typename value_type, typename key_type, typename Compare = std::less<key_type>,
-			typename Alloc = std::allocator<node<value_type> > >
+			typename Alloc = std::allocator<node<value_type> >, typename Balance = ft::rb_balance >
 	class RBTree
 	{
 		public:
 			typedef node<value_type> node_type;
+			typedef Balance balance_type;
 
-			class value_compare : public std::binary_function<value_type, value_type, bool>
+			class value_compare
 				{
 					friend class RBTree;
 					protected :
@@ -71,6 +76,7 @@ namespace ft
 				if (this != &x)
 				{
 					this->destroy_tree();
+					this->_comp = x._comp;
 					node_type * node = x.minimum(x._root);
 					while (node != x._sentinel)
 					{
@@ -86,6 +92,8 @@ namespace ft
 				std::swap(this->_root, x._root);
 				std::swap(this->_sentinel, x._sentinel);
 				std::swap(this->_size, x._size);
+				std::swap(this->_alloc, x._alloc);
+				std::swap(this->_comp, x._comp);
 			}
 
 			node<value_type>*
@@ -93,7 +101,15 @@ namespace ft
 					  node<value_type> *right, const value_type &val, int color = E_RED)
 			{
 				to_init = this->_alloc.allocate(1);
-				this->_alloc.construct(to_init, val);
+				try
+				{
+					this->_alloc.construct(to_init, val);
+				}
+				catch (...)
+				{
+					this->_alloc.deallocate(to_init, 1);
+					throw ;
+				}
 				to_init->parent = parent;
 				to_init->left = left;
 				to_init->right = right;
@@ -101,18 +117,14 @@ namespace ft
 				return to_init;
 			}
 
+			// frees every node in one post-order walk, no rebalancing
 			void destroy_tree()
 			{
 				if (this->_size == 0)
 					return ;
-				node<value_type> *it = this->minimum(this->_root);
-				while (this->_size > 0)
-				{
-					this->erase(it);
-					if (this->_size > 0)
-						it = this->minimum(this->_root);
-				}
+				this->free_subtree(this->_root);
 				this->_root = this->_sentinel;
+				this->_size = 0;
 			}
 
 			size_t max_size() const
@@ -217,13 +229,15 @@ namespace ft
 				if (this->_size == 0)
 				{
 					to_ins = this->init_node(to_ins, this->_sentinel, this->_sentinel,
-						this->_sentinel, ins, E_BLACK);
+						this->_sentinel, ins, Balance::leaf);
 					this->_root = to_ins;
 					this->_size++;
+					Balance::post_insert(*this, to_ins);
 					return (this->_root);
 				}
-				else
-					return (insert2(ins, to_move, to_ins));
+				to_ins = insert2(ins, to_move, to_ins);
+				FT_DEBUG_CHECK(this->verify(), "RBTree::insert: invariant broken");
+				return (to_ins);
 			}
 
 			node<value_type>* insert2(const value_type& ins, node<value_type> *to_move, node<value_type> *to_ins)
@@ -233,11 +247,11 @@ namespace ft
 					if (to_move->left == this->_sentinel)
 					{
 						to_ins = this->init_node(to_ins, to_move, this->_sentinel,
-							this->_sentinel, ins, E_RED);
+							this->_sentinel, ins, Balance::leaf);
 						to_move->left = to_ins;
 						this->_size++;
 						to_move = to_ins;
-						rb_tree_post_insert(to_ins);
+						Balance::post_insert(*this, to_ins);
 						return to_move;
 					}
 					else
@@ -254,11 +268,11 @@ namespace ft
 					if (to_move->right == this->_sentinel)
 					{
 						to_ins = this->init_node(to_ins, to_move, this->_sentinel,
-							this->_sentinel, ins, E_RED);
+							this->_sentinel, ins, Balance::leaf);
 						to_move->right = to_ins;
 						this->_size++;
 						to_move = to_ins;
-						rb_tree_post_insert(to_ins);
+						Balance::post_insert(*this, to_ins);
 						return to_move;
 					}
 					else
@@ -269,65 +283,40 @@ namespace ft
 				}
 			}
 
-			void rb_tree_post_insert(node<value_type> *z)
+			// inserts ins right before pos (the sentinel meaning the end), pos
+			// must be the lower bound of ins and not hold the same key
+			node<value_type>* insert_before(node<value_type> *pos, const value_type& ins)
 			{
-				node<value_type> *z_gp = z->parent->parent;
-				node<value_type> *z_p = z->parent;
-				while (z_p->color == E_RED)
-				{
-					if (z_p == z_gp->left)
-					{
-						if (z_gp->right->color == E_RED)
-						{
-							z_gp->right->color = E_BLACK;
-							z_gp->left->color = E_BLACK;
-							z_gp->color = E_RED;
-							z = z_gp;
-						}
-						else if (z == z_p->right)
-						{
-							left_rotate(z_p, z);
-							z = z_p;
-						}
-						else
-						{
-							z_p->color = E_BLACK;
-							z_gp->color = E_RED;
-							right_rotate(z_p, z_gp);
-						}
-					}
-					else
-					{
-						if (z_gp->left->color == E_RED)
-						{
-							z_gp->left->color = E_BLACK;
-							z_gp->right->color = E_BLACK;
-							z_gp->color = E_RED;
-							z = z_gp;
-						}
-						else if (z == z_p->left)
-						{
-							right_rotate(z, z_p);
-							z = z_p;
-						}
-						else
-						{
-							z_p->color = E_BLACK;
-							z_gp->color = E_RED;
-							left_rotate(z_gp, z_p); 
-						}
-					}
-					z_p = z->parent;
-					z_gp = z->parent->parent;
-				}
-				this->_root->color = E_BLACK;
+				node<value_type> *to_ins = NULL;
+				node<value_type> *parent;
+
+				if (this->_size == 0)
+					return (this->insert(ins));
+				if (pos == this->_sentinel)
+					parent = maximum(this->_root);
+				else if (pos->left != this->_sentinel)
+					parent = maximum(pos->left);
+				else
+					parent = pos;
+				to_ins = this->init_node(to_ins, parent, this->_sentinel,
+					this->_sentinel, ins, Balance::leaf);
+				if (parent == pos)
+					parent->left = to_ins;
+				else
+					parent->right = to_ins;
+				this->_size++;
+				Balance::post_insert(*this, to_ins);
+				FT_DEBUG_CHECK(this->verify(), "RBTree::insert_before: invariant broken");
+				return to_ins;
 			}
 
 			void	erase(node<value_type> *z)
 			{
 				node<value_type> *y = z;
 				node<value_type> *x;
+				node<value_type> *x_parent = z->parent;
 
+				FT_CHECK(z != this->_sentinel, "RBTree::erase: end() is not erasable");
 				if (this->_size == 0)
 					return ;
 				int color = z->color;
@@ -347,9 +336,13 @@ namespace ft
 					color = y->color;
 					x = y->right;
 					if (y->parent == z) // If y is z's right child
+					{
 						x->parent = y;
+						x_parent = y;
+					}
 					else
 					{
+						x_parent = y->parent;
 						switch_nodes(y, y->right);
 						y->right = z->right;
 						y->right->parent = y;
@@ -360,81 +353,11 @@ namespace ft
 					y->left->parent = y;
 					y->color = z->color;
 				}
+				this->_alloc.destroy(z);
 				this->_alloc.deallocate(z, 1);
 				this->_size--;
-				if (color == E_BLACK)
-					rb_tree_post_erase(x);
-			}
-
-			void	rb_tree_post_erase(node<value_type> *x)
-			{
-				node<value_type> *sibling;
-				while (x != this->_root && x->color == E_BLACK)
-				{
-					if (x == x->parent->left)
-					{
-						sibling = x->parent->right;
-						if (sibling->color == E_RED)
-						{
-							sibling->color = E_BLACK;
-							x->parent->color = E_RED;
-							left_rotate(x->parent, x->parent->right);
-							sibling = x->parent->right;
-						}
-						if (sibling->left->color == E_BLACK && sibling->right->color == E_BLACK)
-						{
-							sibling->color = E_RED;
-							x = x->parent;
-						}
-						else
-						{
-							if (sibling->right->color == E_BLACK)
-							{
-								sibling->left->color = E_BLACK;
-								sibling->color = E_RED;
-								right_rotate(sibling->left, sibling);
-								sibling = x->parent->right;
-							}
-							sibling->color = x->parent->color;
-							x->parent->color = E_BLACK;
-							sibling->right->color = E_BLACK;
-							left_rotate(x->parent, x->parent->right);
-							x = this->_root;
-						}
-					}
-					else
-					{
-						sibling = x->parent->left;
-						if (sibling->color == E_RED)
-						{
-							sibling->color = E_BLACK;
-							x->parent->color = E_RED;
-							right_rotate(x->parent->left, x->parent);
-							sibling = x->parent->left;
-						}
-						if (sibling->right->color == E_BLACK && sibling->left->color == E_BLACK)
-						{
-							sibling->color = E_RED;
-							x = x->parent;
-						}
-						else
-						{
-							if (sibling->left->color == E_BLACK)
-							{
-								sibling->right->color = E_BLACK;
-								sibling->color = E_RED;
-								left_rotate(sibling, sibling->right);
-								sibling = x->parent->left;
-							}
-							sibling->color = x->parent->color;
-							x->parent->color = E_BLACK;
-							sibling->left->color = E_BLACK;
-							right_rotate(x->parent->left, x->parent);
-							x = this->_root;
-						}
-					}
-				}
-				x->color = E_BLACK;
+				Balance::post_erase(*this, x, x_parent, color);
+				FT_DEBUG_CHECK(this->verify(), "RBTree::erase: invariant broken");
 			}
 
 			void switch_nodes(node<value_type> *u, node<value_type> *v)
@@ -448,9 +371,118 @@ namespace ft
 				v->parent = u->parent;
 			}
 
+			/*
+			** BULK BUILD
+			** Replaces the content with the n strictly increasing elements read
+			** from first, in O(n) and without a single rotation: the tree is
+			** built in order, splitting every range at its middle. Elements only
+			** need ->first and ->second, so any pair-like record works.
+			*/
+
+			template<class InputIterator>
+			void build_sorted(InputIterator first, size_t n)
+			{
+				size_t full_depth = 0;
+
+				this->destroy_tree();
+				while ((static_cast<size_t>(2) << full_depth) - 1 <= n)
+					full_depth++;
+				this->_root = build(first, n, 0, full_depth);
+				this->_root->parent = this->_sentinel;
+				this->_size = n;
+				FT_DEBUG_CHECK(this->verify(), "RBTree::build_sorted: input not strictly increasing");
+			}
+
+#if __cplusplus >= 201103L
+			// the same from random access input, the subtrees below the top
+			// levels built as tasks of pool; every node is allocated by the
+			// thread building its subtree. Sequential when the allocator is
+			// not thread safe.
+			template<class RandomIt>
+			void build_sorted(RandomIt first, size_t n, thread_pool &pool)
+			{
+				size_t full_depth = 0;
+				size_t split_depth = 0;
+
+				if (!allocator_is_thread_safe<Alloc>::value || pool.size() == 0)
+					return (this->build_sorted(first, n));
+				this->destroy_tree();
+				while ((static_cast<size_t>(2) << full_depth) - 1 <= n)
+					full_depth++;
+				for (size_t tasks = 1; tasks < 4 * (pool.size() + 1); tasks <<= 1)
+					split_depth++;
+				this->_root = build_parallel(first, n, 0, full_depth, split_depth, pool);
+				this->_root->parent = this->_sentinel;
+				this->_size = n;
+				FT_DEBUG_CHECK(this->verify(), "RBTree::build_sorted: input not strictly increasing");
+			}
+#endif
+
+			node<value_type>* find(const key_type &k) const
+			{
+				node<value_type> *node = this->_root;
+				while (node != this->_sentinel)
+				{
+					if (this->_comp._comp(k, node->key_val.first))
+						node = node->left;
+					else if (this->_comp._comp(node->key_val.first, k))
+						node = node->right;
+					else
+						return node;
+				}
+				return this->_sentinel;
+			}
+
+			// first node whose key is not less than k
+			node<value_type>* lower_bound(const key_type &k) const
+			{ return bound(this->_root, this->_sentinel, k, false); }
+
+			// first node whose key is greater than k
+			node<value_type>* upper_bound(const key_type &k) const
+			{ return bound(this->_root, this->_sentinel, k, true); }
+
+			/*
+			** FINGER SEARCH
+			** Same results, but starting from a known node: climb only until the
+			** subtree holding from also holds the bound, then descend. Costs
+			** O(log d) for a bound d positions ahead of from, falls back to a
+			** search from the root when the bound is not ahead.
+			*/
+
+			node<value_type>* lower_bound(node<value_type> *from, const key_type &k) const
+			{ return finger(from, k, false); }
+
+			node<value_type>* upper_bound(node<value_type> *from, const key_type &k) const
+			{ return finger(from, k, true); }
+
+			// number of nodes on the longest root to leaf path
+			size_t depth() const
+			{ return depth(this->_root); }
+
+			size_t depth(node<value_type> *node) const
+			{
+				if (node == this->_sentinel)
+					return 0;
+				size_t l = depth(node->left);
+				size_t r = depth(node->right);
+				return (l > r ? l : r) + 1;
+			}
+
 			size_t size() const
 			{ return this->_size; }
 
+			// walks the whole tree: keys strictly increasing, parent links, size
+			// and the balancing policy's own invariants (FT_HARDENING 2)
+			bool verify() const
+			{
+				node<value_type> *prev = NULL;
+				size_t count = 0;
+
+				if (this->_root != this->_sentinel && this->_root->parent != this->_sentinel)
+					return false;
+				return (this->check(this->_root, prev, count) >= 0 && count == this->_size);
+			}
+
 			node<value_type> *root() const
 			{ return this->_root; }
 
@@ -458,6 +490,149 @@ namespace ft
 			{ return this->_sentinel; }
 
 		private:
+			template<class InputIterator>
+			node<value_type>* build(InputIterator &first, size_t n, size_t depth, size_t full_depth)
+			{
+				node<value_type> *cur = NULL;
+				node<value_type> *left;
+
+				if (n == 0)
+					return this->_sentinel;
+				left = build(first, (n - 1) / 2, depth + 1, full_depth);
+				try
+				{
+					cur = this->init_node(cur, this->_sentinel, left, this->_sentinel,
+						value_type(first->first, first->second));
+					++first;
+					cur->right = build(first, n - 1 - (n - 1) / 2, depth + 1, full_depth);
+				}
+				catch (...)
+				{
+					this->free_subtree(cur != NULL ? cur : left);
+					throw ;
+				}
+				if (cur->left != this->_sentinel)
+					cur->left->parent = cur;
+				if (cur->right != this->_sentinel)
+					cur->right->parent = cur;
+				Balance::built(cur, depth, full_depth);
+				return cur;
+			}
+
+#if __cplusplus >= 201103L
+			// the left half as a task, the right half here; what was built is
+			// freed if either side throws
+			template<class RandomIt>
+			node<value_type>* build_parallel(RandomIt first, size_t n, size_t depth, size_t full_depth,
+					size_t split_depth, thread_pool &pool)
+			{
+				node<value_type>	*left = this->_sentinel;
+				node<value_type>	*right = this->_sentinel;
+				node<value_type>	*cur = NULL;
+				size_t				half = (n - 1) / 2;
+
+				if (depth >= split_depth || n < 4096)
+					return build(first, n, depth, full_depth);
+				task_group group(pool);
+				group.run([&]() { left = this->build_parallel(first, half, depth + 1, full_depth, split_depth, pool); });
+				try
+				{
+					right = build_parallel(first + (half + 1), n - 1 - half, depth + 1, full_depth, split_depth, pool);
+					group.wait();
+					cur = this->init_node(cur, this->_sentinel, left, right,
+						value_type(first[half].first, first[half].second));
+				}
+				catch (...)
+				{
+					try { group.wait(); }
+					catch (...) {}
+					this->free_subtree(left);
+					this->free_subtree(right);
+					throw ;
+				}
+				if (left != this->_sentinel)
+					left->parent = cur;
+				if (right != this->_sentinel)
+					right->parent = cur;
+				Balance::built(cur, depth, full_depth);
+				return cur;
+			}
+#endif
+
+			// true when cur sorts before the searched bound
+			bool before(node<value_type> *cur, const key_type &k, bool upper) const
+			{
+				if (upper)
+					return (!this->_comp._comp(k, cur->key_val.first));
+				return (this->_comp._comp(cur->key_val.first, k));
+			}
+
+			node<value_type>* bound(node<value_type> *cur, node<value_type> *result,
+					const key_type &k, bool upper) const
+			{
+				while (cur != this->_sentinel)
+				{
+					if (before(cur, k, upper))
+						cur = cur->right;
+					else
+					{
+						result = cur;
+						cur = cur->left;
+					}
+				}
+				return result;
+			}
+
+			node<value_type>* finger(node<value_type> *cur, const key_type &k, bool upper) const
+			{
+				node<value_type> *limit = this->_sentinel;
+
+				if (cur == this->_sentinel || !before(cur, k, upper))
+					return bound(this->_root, this->_sentinel, k, upper);
+				while (cur != this->_root)
+				{
+					if (cur == cur->parent->left && !before(cur->parent, k, upper))
+					{
+						limit = cur->parent;
+						break ;
+					}
+					cur = cur->parent;
+				}
+				return bound(cur->right, limit, k, upper);
+			}
+
+			// the policy's measure of cur's subtree (black height, height...),
+			// -1 when something below is broken
+			int check(node<value_type> *cur, node<value_type> *&prev, size_t &count) const
+			{
+				if (cur == this->_sentinel)
+					return 0;
+				if ((cur->left != this->_sentinel && cur->left->parent != cur)
+					|| (cur->right != this->_sentinel && cur->right->parent != cur))
+					return -1;
+				int left = this->check(cur->left, prev, count);
+				if (left < 0 || (prev != NULL && !this->_comp(prev->key_val, cur->key_val)))
+					return -1;
+				prev = cur;
+				count++;
+				int right = this->check(cur->right, prev, count);
+				if (right < 0)
+					return -1;
+				return Balance::verify(cur, left, right);
+			}
+
+			void free_subtree(node<value_type> *cur)
+			{
+				while (cur != this->_sentinel)
+				{
+					this->free_subtree(cur->right);
+					node<value_type> *left = cur->left;
+					this->_alloc.destroy(cur);
+					this->_alloc.deallocate(cur, 1);
+					cur = left;
+				}
+			}
+
 			value_compare			_comp;
 			Alloc					_alloc;
 			size_t					_size;
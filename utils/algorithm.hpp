@@ -12,22 +12,152 @@
 
 #pragma once
 
+#include <cstring>
+#include <cstddef>
+#include "type_traits.hpp"
+#include "simd.hpp"
+
 namespace ft
 {
-	template <class InputIterator1, class InputIterator2>
-	bool equal(InputIterator1 first1, InputIterator1 last1,
-				InputIterator2 first2)
+	template<class T>
+	class random_access_iterator;
+
+	/*
+	** CONTIGUOUS RANGES
+	** Iterators over elements stored back to back give away a raw pointer.
+	** equal and lexicographical_compare use it to hand integers to memcmp,
+	** which glibc resolves to an SSE2 / AVX2 / EVEX version for the running
+	** CPU. Floating point stays element-wise: 0.0 == -0.0, NaN != NaN.
+	*/
+
+	template<class It>
+	struct is_contiguous_iterator : false_type {};
+
+	template<class T>
+	struct is_contiguous_iterator<T *> : true_type {};
+
+	template<class T>
+	struct is_contiguous_iterator<random_access_iterator<T> > : true_type {};
+
+	// element type of a contiguous iterator, without the const
+	template<class It>
+	struct contiguous_value { typedef void type; };
+
+	template<class T>
+	struct contiguous_value<T *> { typedef typename remove_const<T>::type type; };
+
+	template<class T>
+	struct contiguous_value<random_access_iterator<T> > { typedef typename remove_const<T>::type type; };
+
+	template<class T>
+	const T *to_address(T *p)
+	{ return (p); }
+
+	template<class T>
+	const T *to_address(const random_access_iterator<T> &it)
+	{ return (it.base()); }
+
+	// both ranges are contiguous integers of the same type: equal bytes
+	// mean equal values
+	template<class It1, class It2>
+	struct is_bytewise_equal : integral_constant<bool, is_contiguous_iterator<It1>::value
+		&& is_same<typename contiguous_value<It1>::type, typename contiguous_value<It2>::type>::value
+		&& is_integral<typename contiguous_value<It1>::type>::value> {};
+
+	// on top of that memcmp's unsigned byte order is the value order
+	template<class T>
+	struct is_bytewise_ordered : integral_constant<bool, is_same<T, unsigned char>::value
+		|| is_same<T, bool>::value || (is_same<T, char>::value && static_cast<char>(-1) > 0)> {};
+
+	// index of the first difference between a and b, n if none: memcmp
+	// skips the equal blocks, the last one is searched element by element
+	template<class T>
+	size_t mismatch_index(const T *a, const T *b, size_t n)
+	{
+		const size_t	block = (256 > sizeof(T) ? 256 / sizeof(T) : 1);
+		size_t			i = 0;
+
+		while (n - i >= block && std::memcmp(a + i, b + i, block * sizeof(T)) == 0)
+			i += block;
+		while (i < n && a[i] == b[i])
+			i++;
+		return (i);
+	}
+
+	// the overloads picked by tag, kept out of the public names
+	namespace detail
 	{
-		for (; first1 != last1; first1++, first2++)
+		template <class InputIterator1, class InputIterator2>
+		bool equal(InputIterator1 first1, InputIterator1 last1,
+					InputIterator2 first2, ft::false_type)
 		{
-			if (*first1 != *first2)
-				return (false);
+			for (; first1 != last1; first1++, first2++)
+			{
+				if (*first1 != *first2)
+					return (false);
+			}
+			return (true);
+		}
+
+		template <class InputIterator1, class InputIterator2>
+		bool equal(InputIterator1 first1, InputIterator1 last1,
+					InputIterator2 first2, ft::true_type)
+		{
+			size_t n = last1 - first1;
+
+			return (!n || std::memcmp(ft::to_address(first1), ft::to_address(first2),
+				n * sizeof(typename contiguous_value<InputIterator1>::type)) == 0);
 		}
-		return (true);
-	};
+
+		template <class InputIterator1, class InputIterator2>
+		bool lexicographical_compare (InputIterator1 first1, InputIterator1 last1,
+									InputIterator2 first2, InputIterator2 last2, ft::false_type)
+		{
+			for ( ; first1 != last1; first1++, first2++)
+			{
+				if (first2 == last2 || *first2 < *first1)
+					return (false);
+				if (*first1 < *first2)
+					return (true);
+			}
+			return (first2 != last2);
+		}
+
+		template <class InputIterator1, class InputIterator2>
+		bool lexicographical_compare (InputIterator1 first1, InputIterator1 last1,
+									InputIterator2 first2, InputIterator2 last2, ft::true_type)
+		{
+			typedef typename contiguous_value<InputIterator1>::type value_type;
+
+			size_t				n1 = last1 - first1;
+			size_t				n2 = last2 - first2;
+			size_t				n = (n1 < n2 ? n1 : n2);
+			const value_type	*a = ft::to_address(first1);
+			const value_type	*b = ft::to_address(first2);
+
+			if (is_bytewise_ordered<value_type>::value)
+			{
+				int diff = (n ? std::memcmp(a, b, n) : 0);
+				if (diff)
+					return (diff < 0);
+			}
+			else
+			{
+				size_t i = mismatch_index(a, b, n);
+				if (i < n)
+					return (a[i] < b[i]);
+			}
+			return (n1 < n2);
+		}
+	}
+
+	template <class InputIterator1, class InputIterator2>
+	bool equal(InputIterator1 first1, InputIterator1 last1,
+				InputIterator2 first2)
+	{ return (ft::detail::equal(first1, last1, first2, typename is_bytewise_equal<InputIterator1, InputIterator2>::type())); }
 
 	template< class InputIterator1, class InputIterator2, class BinaryPredicate >
-	bool equal(InputIterator1 first1, InputIterator2 last1, InputIterator2 first2, BinaryPredicate p)
+	bool equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, BinaryPredicate p)
 	{
 		for ( ; first1 != last1; first1++, first2++)
 		{
@@ -41,15 +171,9 @@ namespace ft
 	bool lexicographical_compare (InputIterator1 first1, InputIterator1 last1,
 								InputIterator2 first2, InputIterator2 last2)
 	{
-		for ( ; first1 != last1; first1++, first2++)
-		{
-			if (first2 == last2 || *first2 < *first1)
-				return (false);
-			if (*first1 < *first2)
-				return (true);
-		}
-		return (first2 != last2);
-	};
+		return (ft::detail::lexicographical_compare(first1, last1, first2, last2,
+			typename is_bytewise_equal<InputIterator1, InputIterator2>::type()));
+	}
 
 	template< class InputIterator1, class InputIterator2, class Compare >
 	bool lexicographical_compare(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2, Compare comp)
@@ -61,6 +185,174 @@ namespace ft
 			if (comp(*first1, *first2))
 				return (true);
 		}
-		return (true);
+		return (first2 != last2);
+	}
+
+	/*
+	** SEARCHES AND REDUCTIONS
+	** Plain loops, except over contiguous int or float searched for a value
+	** of the same type: those go to the SIMD kernels of simd.hpp. accumulate
+	** only does so for int, a vectorized float sum would round differently.
+	*/
+
+	template<class It, class T>
+	struct is_simd_searchable : integral_constant<bool, is_contiguous_iterator<It>::value
+		&& is_same<typename contiguous_value<It>::type, T>::value
+		&& (is_same<T, int>::value || is_same<T, float>::value)> {};
+
+	namespace detail
+	{
+		template<class InputIterator, class T>
+		InputIterator find(InputIterator first, InputIterator last, const T &val, ft::false_type)
+		{
+			for (; first != last; first++)
+			{
+				if (*first == val)
+					break ;
+			}
+			return (first);
+		}
+
+		template<class InputIterator, class T>
+		InputIterator find(InputIterator first, InputIterator last, const T &val, ft::true_type)
+		{ return (first + ft::simd::find(ft::to_address(first), last - first, val)); }
+
+		template<class InputIterator, class T>
+		std::ptrdiff_t count(InputIterator first, InputIterator last, const T &val, ft::false_type)
+		{
+			std::ptrdiff_t n = 0;
+
+			for (; first != last; first++)
+			{
+				if (*first == val)
+					n++;
+			}
+			return (n);
+		}
+
+		template<class InputIterator, class T>
+		std::ptrdiff_t count(InputIterator first, InputIterator last, const T &val, ft::true_type)
+		{ return (ft::simd::count(ft::to_address(first), last - first, val)); }
+
+		template<class ForwardIterator>
+		ForwardIterator min_element(ForwardIterator first, ForwardIterator last, ft::false_type)
+		{
+			ForwardIterator best = first;
+
+			if (first == last)
+				return (last);
+			while (++first != last)
+			{
+				if (*first < *best)
+					best = first;
+			}
+			return (best);
+		}
+
+		template<class ForwardIterator>
+		ForwardIterator min_element(ForwardIterator first, ForwardIterator last, ft::true_type)
+		{ return (first + ft::simd::extremum<false>(ft::to_address(first), last - first)); }
+
+		template<class ForwardIterator>
+		ForwardIterator max_element(ForwardIterator first, ForwardIterator last, ft::false_type)
+		{
+			ForwardIterator best = first;
+
+			if (first == last)
+				return (last);
+			while (++first != last)
+			{
+				if (*best < *first)
+					best = first;
+			}
+			return (best);
+		}
+
+		template<class ForwardIterator>
+		ForwardIterator max_element(ForwardIterator first, ForwardIterator last, ft::true_type)
+		{ return (first + ft::simd::extremum<true>(ft::to_address(first), last - first)); }
+
+		template<class InputIterator, class T>
+		T accumulate(InputIterator first, InputIterator last, T init, ft::false_type)
+		{
+			for (; first != last; first++)
+				init = init + *first;
+			return (init);
+		}
+
+		// int additions wrap in the kernel, they would overflow in the loop
+		template<class InputIterator, class T>
+		T accumulate(InputIterator first, InputIterator last, T init, ft::true_type)
+		{
+			return (static_cast<T>(static_cast<unsigned int>(init)
+				+ static_cast<unsigned int>(ft::simd::sum(ft::to_address(first), last - first))));
+		}
+	}
+
+	template<class InputIterator, class T>
+	InputIterator find(InputIterator first, InputIterator last, const T &val)
+	{ return (ft::detail::find(first, last, val, typename is_simd_searchable<InputIterator, T>::type())); }
+
+	template<class InputIterator, class T>
+	std::ptrdiff_t count(InputIterator first, InputIterator last, const T &val)
+	{ return (ft::detail::count(first, last, val, typename is_simd_searchable<InputIterator, T>::type())); }
+
+	template<class ForwardIterator, class Compare>
+	ForwardIterator min_element(ForwardIterator first, ForwardIterator last, Compare comp)
+	{
+		ForwardIterator best = first;
+
+		if (first == last)
+			return (last);
+		while (++first != last)
+		{
+			if (comp(*first, *best))
+				best = first;
+		}
+		return (best);
+	}
+
+	template<class ForwardIterator>
+	ForwardIterator min_element(ForwardIterator first, ForwardIterator last)
+	{
+		return (ft::detail::min_element(first, last, typename is_simd_searchable<ForwardIterator,
+			typename contiguous_value<ForwardIterator>::type>::type()));
+	}
+
+	template<class ForwardIterator, class Compare>
+	ForwardIterator max_element(ForwardIterator first, ForwardIterator last, Compare comp)
+	{
+		ForwardIterator best = first;
+
+		if (first == last)
+			return (last);
+		while (++first != last)
+		{
+			if (comp(*best, *first))
+				best = first;
+		}
+		return (best);
+	}
+
+	template<class ForwardIterator>
+	ForwardIterator max_element(ForwardIterator first, ForwardIterator last)
+	{
+		return (ft::detail::max_element(first, last, typename is_simd_searchable<ForwardIterator,
+			typename contiguous_value<ForwardIterator>::type>::type()));
+	}
+
+	template<class InputIterator, class T, class BinaryOperation>
+	T accumulate(InputIterator first, InputIterator last, T init, BinaryOperation op)
+	{
+		for (; first != last; first++)
+			init = op(init, *first);
+		return (init);
+	}
+
+	template<class InputIterator, class T>
+	T accumulate(InputIterator first, InputIterator last, T init)
+	{
+		return (ft::detail::accumulate(first, last, init, typename integral_constant<bool,
+			is_simd_searchable<InputIterator, T>::value && is_same<T, int>::value>::type()));
 	}
-}
+}
\ No newline at end of file
@@ -0,0 +1,215 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+#include <new>
+#include <limits>
+#include <cstddef>
+#include "type_traits.hpp"
+#include "memory.hpp"
+#if __cplusplus >= 201103L
+# include <utility>
+#endif
+
+/*
+** ARENA
+** A monotonic allocator: memory is carved out of big chunks with a bump
+** pointer and never given back one block at a time. reset() drops
+** everything at once and keeps the last (largest) chunk for the next round.
+** Containers using it through arena_allocator must be destroyed or cleared
+** before the reset, their destructors still run on memory that is about to
+** be reused.
+*/
+
+namespace ft
+{
+	class arena
+	{
+		public:
+			explicit arena(size_t chunk_size = 64 * 1024)
+			: _head(NULL), _cur(NULL), _end(NULL), _chunk_size(chunk_size), _used(0)
+			{}
+
+			~arena()
+			{
+				while (_head != NULL)
+				{
+					chunk *next = _head->next;
+					::operator delete(_head);
+					_head = next;
+				}
+			}
+
+			// align must be a power of two
+			void *allocate(size_t bytes, size_t align)
+			{
+				char *p = align_up(_cur, align);
+				if (_cur == NULL || p > _end || bytes > static_cast<size_t>(_end - p))
+				{
+					grow(bytes + align);
+					p = align_up(_cur, align);
+				}
+				_cur = p + bytes;
+				_used += bytes;
+				return (p);
+			}
+
+			void reset()
+			{
+				if (_head == NULL)
+					return ;
+				while (_head->next != NULL)
+				{
+					chunk *next = _head->next;
+					_head->next = next->next;
+					::operator delete(next);
+				}
+				_cur = reinterpret_cast<char *>(_head + 1);
+				_used = 0;
+			}
+
+			// bytes handed out since the last reset
+			size_t used() const
+			{ return (_used); }
+
+			// bytes held in chunks
+			size_t reserved() const
+			{
+				size_t total = 0;
+				for (chunk *c = _head; c != NULL; c = c->next)
+					total += c->size;
+				return (total);
+			}
+
+		private:
+			struct chunk
+			{
+				chunk	*next;
+				size_t	size;
+			};
+
+			arena(const arena &);
+			arena &operator=(const arena &);
+
+			static char *align_up(char *p, size_t align)
+			{ return (reinterpret_cast<char *>((reinterpret_cast<size_t>(p) + align - 1) & ~(align - 1))); }
+
+			// chunks double so a burst costs a logarithmic number of them,
+			// the newest one is the head
+			void grow(size_t bytes)
+			{
+				size_t size = _chunk_size;
+				while (size < bytes + sizeof(chunk))
+					size *= 2;
+				chunk *c = static_cast<chunk *>(::operator new(size));
+				c->next = _head;
+				c->size = size;
+				_head = c;
+				_cur = reinterpret_cast<char *>(c + 1);
+				_end = reinterpret_cast<char *>(c) + size;
+				_chunk_size = size * 2;
+			}
+
+			chunk	*_head;
+			char	*_cur;
+			char	*_end;
+			size_t	_chunk_size;
+			size_t	_used;
+	};
+
+	/*
+	** ARENA ALLOCATOR
+	** The Alloc side of an arena: deallocate does nothing. A default
+	** constructed one has no arena and forwards to operator new/delete.
+	*/
+
+	template<class T>
+	class arena_allocator
+	{
+		public:
+			typedef T				value_type;
+			typedef T*				pointer;
+			typedef const T*		const_pointer;
+			typedef T&				reference;
+			typedef const T&		const_reference;
+			typedef std::size_t		size_type;
+			typedef std::ptrdiff_t	difference_type;
+
+			template<class U>
+			struct rebind { typedef arena_allocator<U> other; };
+
+			arena_allocator() : _arena(NULL) {}
+
+			arena_allocator(ft::arena &a) : _arena(&a) {}
+
+			template<class U>
+			arena_allocator(const arena_allocator<U> &other) : _arena(other.resource()) {}
+
+			ft::arena *resource() const
+			{ return (_arena); }
+
+			pointer address(reference x) const
+			{ return (&x); }
+
+			const_pointer address(const_reference x) const
+			{ return (&x); }
+
+			pointer allocate(size_type n, const void *hint = 0)
+			{
+				(void)hint;
+				if (n > max_size())
+					throw std::bad_alloc();
+				if (_arena == NULL)
+					return (static_cast<pointer>(::operator new(n * sizeof(value_type))));
+				return (static_cast<pointer>(_arena->allocate(n * sizeof(value_type),
+					ft::alignment_of<value_type>::value)));
+			}
+
+			void deallocate(pointer p, size_type n)
+			{
+				(void)n;
+				if (_arena == NULL)
+					::operator delete(p);
+			}
+
+			size_type max_size() const
+			{ return (std::numeric_limits<size_type>::max() / sizeof(value_type)); }
+
+			void construct(pointer p, const_reference val)
+			{ ::new (static_cast<void *>(p)) value_type(val); }
+
+#if __cplusplus >= 201103L
+			template<class U, class... Args>
+			void construct(U *p, Args&&... args)
+			{ ::new (static_cast<void *>(p)) U(std::forward<Args>(args)...); }
+#endif
+
+			void destroy(pointer p)
+			{ p->~value_type(); }
+
+		private:
+			ft::arena	*_arena;
+	};
+
+	template<class T, class U>
+	bool operator==(const arena_allocator<T> &lhs, const arena_allocator<U> &rhs)
+	{ return (lhs.resource() == rhs.resource()); }
+
+	template<class T, class U>
+	bool operator!=(const arena_allocator<T> &lhs, const arena_allocator<U> &rhs)
+	{ return (!(lhs == rhs)); }
+
+	// the arena's bump pointer is not guarded
+	template<class T>
+	struct allocator_is_thread_safe<arena_allocator<T> > : false_type {};
+}
@@ -0,0 +1,300 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   balance.hpp                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+#include <cstddef>
+#include "enums.hpp"
+
+/*
+** BALANCING POLICIES (FOR RBTREE)
+** A policy owns the meaning of node::color and restores the tree invariants
+** after a plain binary search tree insertion or removal, using the tree's
+** left_rotate / right_rotate. verify checks them for FT_HARDENING 2.
+*/
+
+namespace ft
+{
+	/*
+	** RED-BLACK
+	** node::color is E_RED or E_BLACK. Cheap rebalancing (at most 2 rotations
+	** per insert, 3 per erase), trees up to 2 * log2(n) deep.
+	*/
+
+	struct rb_balance
+	{
+		static const int leaf = E_RED;
+
+		template<class Tree>
+		static void post_insert(Tree &tree, typename Tree::node_type *z)
+		{
+			typename Tree::node_type *z_gp = z->parent->parent;
+			typename Tree::node_type *z_p = z->parent;
+			while (z_p->color == E_RED)
+			{
+				if (z_p == z_gp->left)
+				{
+					if (z_gp->right->color == E_RED)
+					{
+						z_gp->right->color = E_BLACK;
+						z_gp->left->color = E_BLACK;
+						z_gp->color = E_RED;
+						z = z_gp;
+					}
+					else if (z == z_p->right)
+					{
+						tree.left_rotate(z_p, z);
+						z = z_p;
+					}
+					else
+					{
+						z_p->color = E_BLACK;
+						z_gp->color = E_RED;
+						tree.right_rotate(z_p, z_gp);
+					}
+				}
+				else
+				{
+					if (z_gp->left->color == E_RED)
+					{
+						z_gp->left->color = E_BLACK;
+						z_gp->right->color = E_BLACK;
+						z_gp->color = E_RED;
+						z = z_gp;
+					}
+					else if (z == z_p->left)
+					{
+						tree.right_rotate(z, z_p);
+						z = z_p;
+					}
+					else
+					{
+						z_p->color = E_BLACK;
+						z_gp->color = E_RED;
+						tree.left_rotate(z_gp, z_p);
+					}
+				}
+				z_p = z->parent;
+				z_gp = z->parent->parent;
+			}
+			tree.root()->color = E_BLACK;
+		}
+
+		// x took the place of the removed node, removed is the color it had
+		template<class Tree>
+		static void post_erase(Tree &tree, typename Tree::node_type *x,
+				typename Tree::node_type *x_parent, int removed)
+		{
+			typename Tree::node_type *sibling;
+
+			(void)x_parent;
+			if (removed != E_BLACK)
+				return ;
+			while (x != tree.root() && x->color == E_BLACK)
+			{
+				if (x == x->parent->left)
+				{
+					sibling = x->parent->right;
+					if (sibling->color == E_RED)
+					{
+						sibling->color = E_BLACK;
+						x->parent->color = E_RED;
+						tree.left_rotate(x->parent, x->parent->right);
+						sibling = x->parent->right;
+					}
+					if (sibling->left->color == E_BLACK && sibling->right->color == E_BLACK)
+					{
+						sibling->color = E_RED;
+						x = x->parent;
+					}
+					else
+					{
+						if (sibling->right->color == E_BLACK)
+						{
+							sibling->left->color = E_BLACK;
+							sibling->color = E_RED;
+							tree.right_rotate(sibling->left, sibling);
+							sibling = x->parent->right;
+						}
+						sibling->color = x->parent->color;
+						x->parent->color = E_BLACK;
+						sibling->right->color = E_BLACK;
+						tree.left_rotate(x->parent, x->parent->right);
+						x = tree.root();
+					}
+				}
+				else
+				{
+					sibling = x->parent->left;
+					if (sibling->color == E_RED)
+					{
+						sibling->color = E_BLACK;
+						x->parent->color = E_RED;
+						tree.right_rotate(x->parent->left, x->parent);
+						sibling = x->parent->left;
+					}
+					if (sibling->right->color == E_BLACK && sibling->left->color == E_BLACK)
+					{
+						sibling->color = E_RED;
+						x = x->parent;
+					}
+					else
+					{
+						if (sibling->left->color == E_BLACK)
+						{
+							sibling->right->color = E_BLACK;
+							sibling->color = E_RED;
+							tree.left_rotate(sibling, sibling->right);
+							sibling = x->parent->left;
+						}
+						sibling->color = x->parent->color;
+						x->parent->color = E_BLACK;
+						sibling->left->color = E_BLACK;
+						tree.right_rotate(x->parent->left, x->parent);
+						x = tree.root();
+					}
+				}
+			}
+			x->color = E_BLACK;
+		}
+
+		// bulk build: the levels above full_depth are complete, paint them
+		// black and the partial bottom level red
+		template<class Node>
+		static void built(Node *node, size_t depth, size_t full_depth)
+		{ node->color = (depth < full_depth ? E_BLACK : E_RED); }
+
+		// left and right are the black heights of the children: no red node
+		// with a red child, the same number of black nodes on every path
+		template<class Node>
+		static int verify(const Node *node, int left, int right)
+		{
+			if (node->color != E_RED && node->color != E_BLACK)
+				return (-1);
+			if (node->color == E_RED && (node->left->color == E_RED || node->right->color == E_RED))
+				return (-1);
+			if (left != right)
+				return (-1);
+			return (left + (node->color == E_BLACK));
+		}
+	};
+
+	/*
+	** AVL
+	** node::color is the height of the subtree (the sentinel is 0). More
+	** rotations on writes, but trees stay under 1.44 * log2(n) deep.
+	*/
+
+	struct avl_balance
+	{
+		static const int leaf = 1;
+
+		template<class Tree>
+		static void post_insert(Tree &tree, typename Tree::node_type *z)
+		{
+			typename Tree::node_type *node = z->parent;
+			int old_height;
+
+			while (node != tree.sentinel())
+			{
+				old_height = node->color;
+				node = rebalance(tree, node);
+				if (node->color == old_height)
+					break ;
+				node = node->parent;
+			}
+		}
+
+		// x_parent is the deepest node whose subtree lost a level
+		template<class Tree>
+		static void post_erase(Tree &tree, typename Tree::node_type *x,
+				typename Tree::node_type *x_parent, int removed)
+		{
+			(void)x;
+			(void)removed;
+			while (x_parent != tree.sentinel())
+				x_parent = rebalance(tree, x_parent)->parent;
+		}
+
+		// bulk build: children are built first, only the height is needed
+		template<class Node>
+		static void built(Node *node, size_t depth, size_t full_depth)
+		{
+			(void)depth;
+			(void)full_depth;
+			update(node);
+		}
+
+		// left and right are the heights of the children: the stored height
+		// is right and the subtree is balanced
+		template<class Node>
+		static int verify(const Node *node, int left, int right)
+		{
+			if (node->color != (left > right ? left : right) + 1)
+				return (-1);
+			if (left - right > 1 || right - left > 1)
+				return (-1);
+			return (node->color);
+		}
+
+		private:
+			template<class Node>
+			static void update(Node *node)
+			{
+				int l = node->left->color;
+				int r = node->right->color;
+				node->color = (l > r ? l : r) + 1;
+			}
+
+			template<class Node>
+			static int factor(Node *node)
+			{ return (node->left->color - node->right->color); }
+
+			// returns the new root of node's subtree
+			template<class Tree>
+			static typename Tree::node_type *rebalance(Tree &tree, typename Tree::node_type *node)
+			{
+				typename Tree::node_type *child;
+
+				update(node);
+				if (factor(node) > 1)
+				{
+					child = node->left;
+					if (factor(child) < 0)
+					{
+						tree.left_rotate(child, child->right);
+						update(child);
+						child = child->parent;
+					}
+					tree.right_rotate(child, node);
+					update(node);
+					update(child);
+					return (child);
+				}
+				if (factor(node) < -1)
+				{
+					child = node->right;
+					if (factor(child) > 0)
+					{
+						tree.right_rotate(child->left, child);
+						update(child);
+						child = child->parent;
+					}
+					tree.left_rotate(node, child);
+					update(node);
+					update(child);
+					return (child);
+				}
+				return (node);
+			}
+	};
+}
@@ -0,0 +1,325 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bloom_filter.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+#include <stdint.h>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <new>
+#include <algorithm>
+#if __cplusplus >= 201103L
+# include <atomic>
+#endif
+
+/*
+** BLOOM FILTERS (FOR MAP)
+** Optional front for map::find, given as the map's Filter parameter. A
+** filter only learns keys: erased keys stay "maybe present" until
+** map::rebuild_filter() is called.
+*/
+
+namespace ft
+{
+	/*
+	** HASH
+	** Specialize ft::hash for other key types.
+	*/
+
+	inline uint64_t hash_mix(uint64_t x)
+	{
+		x ^= x >> 33;
+		x *= 0xff51afd7ed558ccdULL;
+		x ^= x >> 33;
+		x *= 0xc4ceb9fe1a85ec53ULL;
+		x ^= x >> 33;
+		return (x);
+	}
+
+	template<class Key>
+	struct hash;
+
+	template<class Key>
+	struct integral_hash
+	{
+		uint64_t operator()(const Key &k) const
+		{ return (hash_mix(static_cast<uint64_t>(k))); }
+	};
+
+	template<> struct hash<char> : integral_hash<char> {};
+	template<> struct hash<unsigned char> : integral_hash<unsigned char> {};
+	template<> struct hash<short> : integral_hash<short> {};
+	template<> struct hash<unsigned short> : integral_hash<unsigned short> {};
+	template<> struct hash<int> : integral_hash<int> {};
+	template<> struct hash<unsigned int> : integral_hash<unsigned int> {};
+	template<> struct hash<long> : integral_hash<long> {};
+	template<> struct hash<unsigned long> : integral_hash<unsigned long> {};
+	template<> struct hash<long long> : integral_hash<long long> {};
+	template<> struct hash<unsigned long long> : integral_hash<unsigned long long> {};
+
+	template<>
+	struct hash<std::string>
+	{
+		uint64_t operator()(const std::string &k) const
+		{
+			uint64_t h = 14695981039346656037ULL;
+			for (std::string::size_type i = 0; i < k.size(); i++)
+				h = (h ^ static_cast<unsigned char>(k[i])) * 1099511628211ULL;
+			return (hash_mix(h));
+		}
+	};
+
+	/*
+	** NO FILTER
+	** The default: every key may be present, compiles down to nothing.
+	*/
+
+	struct no_filter
+	{
+		template<class Key>
+		void add(const Key &) {}
+
+		template<class Key>
+		bool may_contain(const Key &) const
+		{ return (true); }
+
+		void false_positive() const {}
+
+		bool needs_rebuild(size_t) const
+		{ return (false); }
+
+		void reset(size_t) {}
+
+		void clear() {}
+
+		void swap(no_filter &) {}
+	};
+
+	/*
+	** STATISTICS COUNTER
+	** Bumped by the const lookups: under C++11 a relaxed atomic, so threads
+	** calling find on the same const map do not race on it.
+	*/
+
+	class stat_counter
+	{
+		public:
+			stat_counter() : _n(0) {}
+
+			stat_counter(const stat_counter &x) : _n(x.load()) {}
+
+			stat_counter &operator=(const stat_counter &x)
+			{
+				this->store(x.load());
+				return (*this);
+			}
+
+#if __cplusplus >= 201103L
+			void increment()
+			{ _n.fetch_add(1, std::memory_order_relaxed); }
+
+			unsigned long load() const
+			{ return (_n.load(std::memory_order_relaxed)); }
+
+			void store(unsigned long n)
+			{ _n.store(n, std::memory_order_relaxed); }
+
+		private:
+			std::atomic<unsigned long>	_n;
+#else
+			void increment()
+			{ _n++; }
+
+			unsigned long load() const
+			{ return (_n); }
+
+			void store(unsigned long n)
+			{ _n = n; }
+
+		private:
+			unsigned long	_n;
+#endif
+	};
+
+	/*
+	** BLOCKED BLOOM FILTER
+	** Every key lives in a single 64 bytes block (one cache line), so a
+	** negative answer costs one miss instead of one per probe. Sized for
+	** BitsPerKey bits per key, it asks the map for a rebuild when the map
+	** outgrows it.
+	*/
+
+	template<class Key, class Hash = ft::hash<Key>, size_t BitsPerKey = 10>
+	class bloom_filter
+	{
+		public:
+			static const size_t	block_bits = 512;
+			static const size_t	probes = (BitsPerKey * 69 + 50) / 100 ? (BitsPerKey * 69 + 50) / 100 : 1;
+
+			bloom_filter() : _blocks(NULL), _nblocks(0), _capacity(0)
+			{ reset_stats(); }
+
+			bloom_filter(const bloom_filter &x) : _blocks(NULL), _nblocks(0), _capacity(0)
+			{ *this = x; }
+
+			~bloom_filter()
+			{ std::free(_blocks); }
+
+			bloom_filter& operator=(const bloom_filter &x)
+			{
+				if (this != &x)
+				{
+					allocate(x._nblocks);
+					if (_nblocks)
+						std::memcpy(_blocks, x._blocks, _nblocks * sizeof(block));
+					_capacity = x._capacity;
+					_hash = x._hash;
+					_queries = x._queries;
+					_negatives = x._negatives;
+					_false_positives = x._false_positives;
+				}
+				return (*this);
+			}
+
+			void add(const Key &k)
+			{
+				uint64_t	h = _hash(k);
+				uint64_t	*words = _blocks[index(h)].words;
+				uint32_t	h1 = static_cast<uint32_t>(h);
+				uint32_t	h2 = static_cast<uint32_t>(h >> 23) | 1;
+
+				for (size_t i = 0; i < probes; i++, h1 += h2)
+					words[(h1 % block_bits) / 64] |= static_cast<uint64_t>(1) << (h1 % 64);
+			}
+
+			// false means definitely absent
+			bool may_contain(const Key &k) const
+			{
+				uint64_t	h = _hash(k);
+				uint32_t	h1 = static_cast<uint32_t>(h);
+				uint32_t	h2 = static_cast<uint32_t>(h >> 23) | 1;
+
+				_queries.increment();
+				if (_nblocks == 0)
+				{
+					_negatives.increment();
+					return (false);
+				}
+				const uint64_t *words = _blocks[index(h)].words;
+				for (size_t i = 0; i < probes; i++, h1 += h2)
+				{
+					if (!(words[(h1 % block_bits) / 64] & (static_cast<uint64_t>(1) << (h1 % 64))))
+					{
+						_negatives.increment();
+						return (false);
+					}
+				}
+				return (true);
+			}
+
+			// the map reports a "maybe" that the tree did not confirm
+			void false_positive() const
+			{ _false_positives.increment(); }
+
+			bool needs_rebuild(size_t keys) const
+			{ return (keys > _capacity); }
+
+			// empties the filter and sizes it for twice the given number of keys
+			void reset(size_t keys)
+			{
+				size_t capacity = (keys < 512 ? 1024 : keys * 2);
+				allocate((capacity * BitsPerKey + block_bits - 1) / block_bits);
+				std::memset(_blocks, 0, _nblocks * sizeof(block));
+				_capacity = capacity;
+			}
+
+			void clear()
+			{
+				if (_nblocks)
+					std::memset(_blocks, 0, _nblocks * sizeof(block));
+			}
+
+			// exchanges the bit arrays, nothing is copied
+			void swap(bloom_filter &x)
+			{
+				std::swap(_blocks, x._blocks);
+				std::swap(_nblocks, x._nblocks);
+				std::swap(_capacity, x._capacity);
+				std::swap(_hash, x._hash);
+				std::swap(_queries, x._queries);
+				std::swap(_negatives, x._negatives);
+				std::swap(_false_positives, x._false_positives);
+			}
+
+			/*
+			** STATISTICS
+			*/
+
+			unsigned long queries() const
+			{ return (_queries.load()); }
+
+			unsigned long negatives() const
+			{ return (_negatives.load()); }
+
+			unsigned long false_positives() const
+			{ return (_false_positives.load()); }
+
+			// share of absent keys the filter failed to reject
+			double false_positive_rate() const
+			{
+				unsigned long false_positives = _false_positives.load();
+				unsigned long absent = _negatives.load() + false_positives;
+				return (absent ? static_cast<double>(false_positives) / absent : 0.0);
+			}
+
+			void reset_stats()
+			{
+				_queries.store(0);
+				_negatives.store(0);
+				_false_positives.store(0);
+			}
+
+			size_t memory() const
+			{ return (_nblocks * sizeof(block)); }
+
+		private:
+			struct block
+			{
+				uint64_t	words[block_bits / 64];
+			};
+
+			size_t index(uint64_t h) const
+			{ return (static_cast<size_t>(((h >> 32) * _nblocks) >> 32)); }
+
+			void allocate(size_t nblocks)
+			{
+				void *mem = NULL;
+
+				if (nblocks == _nblocks)
+					return ;
+				if (nblocks && posix_memalign(&mem, sizeof(block), nblocks * sizeof(block)) != 0)
+					throw std::bad_alloc();
+				std::free(_blocks);
+				_blocks = static_cast<block *>(mem);
+				_nblocks = nblocks;
+			}
+
+			block					*_blocks;
+			size_t					_nblocks;
+			size_t					_capacity;
+			Hash					_hash;
+			mutable stat_counter	_queries;
+			mutable stat_counter	_negatives;
+			mutable stat_counter	_false_positives;
+	};
+}
@@ -0,0 +1,54 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hardening.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+#include <cstdio>
+#include <cstdlib>
+
+/*
+** HARDENING
+** FT_HARDENING picks which precondition checks are compiled in:
+**   0  none, the default: operator[], front(), back()... are plain loads
+**   1  constant time checks: element access in bounds, iterators passed to
+**      insert / erase inside [begin, end], no pop or erase on empty
+**   2  level 1 plus a full walk of the tree checking its invariants after
+**      every map modification, linear time: debug builds only
+** A failed check is a bug in the caller, not an error to recover from: it
+** reports where and aborts. Checks that are off cost nothing, the
+** condition is not even evaluated.
+*/
+
+#ifndef FT_HARDENING
+# define FT_HARDENING 0
+#endif
+
+namespace ft
+{
+	inline void hardening_failure(const char *what, const char *file, int line)
+	{
+		std::fprintf(stderr, "%s:%d: ft hardening: %s\n", file, line, what);
+		std::abort();
+	}
+}
+
+#if FT_HARDENING >= 1
+# define FT_CHECK(cond, what) ((cond) ? (void)0 : ft::hardening_failure(what, __FILE__, __LINE__))
+#else
+# define FT_CHECK(cond, what) ((void)0)
+#endif
+
+#if FT_HARDENING >= 2
+# define FT_DEBUG_CHECK(cond, what) ((cond) ? (void)0 : ft::hardening_failure(what, __FILE__, __LINE__))
+#else
+# define FT_DEBUG_CHECK(cond, what) ((void)0)
+#endif
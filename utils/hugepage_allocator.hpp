@@ -0,0 +1,141 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hugepage_allocator.hpp                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+#include <new>
+#include <limits>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <sys/mman.h>
+#include "memory.hpp"
+
+/*
+** HUGE PAGE ALLOCATOR
+** Blocks of at least Threshold bytes get their own mapping, aligned on and
+** rounded up to 2 MB, and flagged MADV_HUGEPAGE so transparent huge pages
+** back them: one TLB entry covers 2 MB instead of 4 KB. Smaller blocks come
+** from operator new. Without THP the madvise just fails and the mapping
+** stays on normal pages.
+*/
+
+namespace ft
+{
+	static const size_t	hugepage_size = 2 * 1024 * 1024;
+
+	// whether the kernel would honour MADV_HUGEPAGE at all
+	inline bool hugepages_available()
+	{
+		char	mode[128] = { 0 };
+		FILE	*f = std::fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r");
+
+		if (f == NULL)
+			return (false);
+		if (std::fgets(mode, sizeof(mode), f) == NULL)
+			mode[0] = '\0';
+		std::fclose(f);
+		return (std::strstr(mode, "[never]") == NULL && mode[0] != '\0');
+	}
+
+	template<class T, size_t Threshold = hugepage_size>
+	class hugepage_allocator
+	{
+		public:
+			typedef T				value_type;
+			typedef T*				pointer;
+			typedef const T*		const_pointer;
+			typedef T&				reference;
+			typedef const T&		const_reference;
+			typedef std::size_t		size_type;
+			typedef std::ptrdiff_t	difference_type;
+
+			template<class U>
+			struct rebind { typedef hugepage_allocator<U, Threshold> other; };
+
+			hugepage_allocator() {}
+
+			template<class U>
+			hugepage_allocator(const hugepage_allocator<U, Threshold> &) {}
+
+			pointer address(reference x) const
+			{ return (&x); }
+
+			const_pointer address(const_reference x) const
+			{ return (&x); }
+
+			pointer allocate(size_type n, const void *hint = 0)
+			{
+				(void)hint;
+				if (n > max_size())
+					throw std::bad_alloc();
+				if (n * sizeof(value_type) < Threshold)
+					return (static_cast<pointer>(::operator new(n * sizeof(value_type))));
+				return (static_cast<pointer>(map_aligned(bytes(n))));
+			}
+
+			void deallocate(pointer p, size_type n)
+			{
+				if (p == NULL)
+					return ;
+				if (n * sizeof(value_type) < Threshold)
+					::operator delete(p);
+				else
+					munmap(p, bytes(n));
+			}
+
+			size_type max_size() const
+			{ return ((std::numeric_limits<size_type>::max() - 2 * hugepage_size) / sizeof(value_type)); }
+
+			void construct(pointer p, const_reference val)
+			{ ::new (static_cast<void *>(p)) value_type(val); }
+
+#if __cplusplus >= 201103L
+			template<class U, class... Args>
+			void construct(U *p, Args&&... args)
+			{ ::new (static_cast<void *>(p)) U(std::forward<Args>(args)...); }
+#endif
+
+			void destroy(pointer p)
+			{ p->~value_type(); }
+
+		private:
+			static size_type bytes(size_type n)
+			{ return ((n * sizeof(value_type) + hugepage_size - 1) / hugepage_size * hugepage_size); }
+
+			// over-maps by 2 MB, then unmaps the head and the tail around the
+			// first aligned address
+			static void *map_aligned(size_type len)
+			{
+				void *mem = mmap(NULL, len + hugepage_size, PROT_READ | PROT_WRITE,
+					MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+				if (mem == MAP_FAILED)
+					throw std::bad_alloc();
+				char *raw = static_cast<char *>(mem);
+				char *aligned = reinterpret_cast<char *>(
+					(reinterpret_cast<size_t>(raw) + hugepage_size - 1) & ~(hugepage_size - 1));
+				if (aligned != raw)
+					munmap(raw, aligned - raw);
+				munmap(aligned + len, raw + hugepage_size - aligned);
+				madvise(aligned, len, MADV_HUGEPAGE); // no THP: stays on 4 KB pages
+				return (aligned);
+			}
+	};
+
+	template<class T, class U, size_t Threshold>
+	bool operator==(const hugepage_allocator<T, Threshold> &, const hugepage_allocator<U, Threshold> &)
+	{ return (true); }
+
+	template<class T, class U, size_t Threshold>
+	bool operator!=(const hugepage_allocator<T, Threshold> &, const hugepage_allocator<U, Threshold> &)
+	{ return (false); }
+}
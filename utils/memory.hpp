@@ -0,0 +1,157 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   memory.hpp                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+#include <cstring>
+#include <cstddef>
+#include "type_traits.hpp"
+#if __cplusplus >= 201103L
+# include <utility>
+#endif
+
+// moves from the source when the build has move semantics, copies otherwise
+#if __cplusplus >= 201103L
+# define FT_MOVE(x)				std::move(x)
+# define FT_MOVE_IF_NOEXCEPT(x)	std::move_if_noexcept(x)
+#else
+# define FT_MOVE(x)				(x)
+# define FT_MOVE_IF_NOEXCEPT(x)	(x)
+#endif
+
+// keeps a rarely taken growth path out of the loops calling it, which
+// would otherwise spill their registers around it (GCC and clang)
+#define FT_NOINLINE	__attribute__((noinline))
+
+/*
+** RAW STORAGE HELPERS (FOR CONTIGUOUS CONTAINERS)
+** Element-wise construct / destroy through the allocator, or bulk memory
+** operations when the type traits allow it.
+*/
+
+namespace ft
+{
+	// tag asking for default-initialization: trivial types keep whatever
+	// the memory held instead of being zeroed
+	struct default_init_t {};
+
+	static const default_init_t	default_init = default_init_t();
+
+	// data written by different threads is kept this far apart so that each
+	// thread's writes do not invalidate the others' cache lines
+	static const size_t	cache_line_size = 64;
+
+	// allocators with a reallocate(p, old_n, new_n) member keeping the bytes,
+	// like ft::mmap_allocator, specialize this
+	template<class Alloc>
+	struct allocator_can_reallocate : false_type {};
+
+	// allocators that several threads may call at once (the parallel map
+	// build allocates nodes from every worker); those sharing unguarded
+	// state, like ft::arena_allocator, specialize this
+	template<class Alloc>
+	struct allocator_is_thread_safe : true_type {};
+
+	// moves n elements from src to the raw storage at dst (copies them
+	// when their move may throw); if that throws dst is raw again and src
+	// untouched
+	template<class T, class Alloc>
+	void uninitialized_move_n(T *dst, T *src, size_t n, Alloc &alloc)
+	{
+		size_t i = 0;
+
+		try
+		{
+			for (; i < n; i++)
+				alloc.construct(dst + i, FT_MOVE_IF_NOEXCEPT(src[i]));
+		}
+		catch (...)
+		{
+			for (; i > 0; i--)
+				alloc.destroy(dst + (i - 1));
+			throw ;
+		}
+	}
+
+	// moves n elements from src to the raw storage at dst, src ends up raw;
+	// if that throws dst is raw and src untouched
+	template<class T, class Alloc>
+	void uninitialized_relocate(T *dst, T *src, size_t n, Alloc &alloc, ft::true_type)
+	{
+		(void)alloc;
+		if (n)
+			std::memcpy(static_cast<void *>(dst), static_cast<const void *>(src), n * sizeof(T));
+	}
+
+	template<class T, class Alloc>
+	void uninitialized_relocate(T *dst, T *src, size_t n, Alloc &alloc, ft::false_type)
+	{
+		ft::uninitialized_move_n(dst, src, n, alloc);
+		for (size_t i = 0; i < n; i++)
+			alloc.destroy(src + i);
+	}
+
+	template<class T, class Alloc>
+	void uninitialized_relocate(T *dst, T *src, size_t n, Alloc &alloc)
+	{ uninitialized_relocate(dst, src, n, alloc, ft::is_trivially_relocatable<T>()); }
+
+	// copies val into the n raw slots at dst; if that throws dst is raw again
+	template<class T, class Alloc>
+	void uninitialized_fill_n(T *dst, size_t n, const T &val, Alloc &alloc, ft::true_type)
+	{
+		T copy(val);
+		(void)alloc;
+		for (size_t i = 0; i < n; i++)
+			dst[i] = copy;
+	}
+
+	template<class T, class Alloc>
+	void uninitialized_fill_n(T *dst, size_t n, const T &val, Alloc &alloc, ft::false_type)
+	{
+		size_t i = 0;
+
+		try
+		{
+			for (; i < n; i++)
+				alloc.construct(dst + i, val);
+		}
+		catch (...)
+		{
+			for (; i > 0; i--)
+				alloc.destroy(dst + (i - 1));
+			throw ;
+		}
+	}
+
+	template<class T, class Alloc>
+	void uninitialized_fill_n(T *dst, size_t n, const T &val, Alloc &alloc)
+	{ uninitialized_fill_n(dst, n, val, alloc, ft::is_trivially_copyable<T>()); }
+
+	// default-initializes the n raw slots at dst
+	template<class T, class Alloc>
+	void uninitialized_default_n(T *dst, size_t n, Alloc &alloc)
+	{
+		if (ft::is_trivially_default_constructible<T>::value)
+			return ;
+		for (size_t i = 0; i < n; i++)
+			alloc.construct(dst + i, T());
+	}
+
+	template<class T, class Alloc>
+	void destroy_range(T *first, T *last, Alloc &alloc)
+	{
+		if (ft::is_trivially_destructible<T>::value)
+			return ;
+		for (; first != last; first++)
+			alloc.destroy(first);
+	}
+}
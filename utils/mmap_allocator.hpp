@@ -0,0 +1,134 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mmap_allocator.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+#include <new>
+#include <limits>
+#include <cstddef>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "memory.hpp"
+
+/*
+** MMAP ALLOCATOR
+** Every block is its own anonymous mapping, rounded up to whole pages, so
+** it only suits large buffers. It can reallocate with mremap: the kernel
+** moves the page table entries instead of the bytes, and containers use
+** that for trivially relocatable elements (see allocator_can_reallocate).
+*/
+
+namespace ft
+{
+	template<class T>
+	class mmap_allocator
+	{
+		public:
+			typedef T				value_type;
+			typedef T*				pointer;
+			typedef const T*		const_pointer;
+			typedef T&				reference;
+			typedef const T&		const_reference;
+			typedef std::size_t		size_type;
+			typedef std::ptrdiff_t	difference_type;
+
+			template<class U>
+			struct rebind { typedef mmap_allocator<U> other; };
+
+			mmap_allocator() {}
+
+			template<class U>
+			mmap_allocator(const mmap_allocator<U> &) {}
+
+			pointer address(reference x) const
+			{ return (&x); }
+
+			const_pointer address(const_reference x) const
+			{ return (&x); }
+
+			pointer allocate(size_type n, const void *hint = 0)
+			{
+				(void)hint;
+				if (!n)
+					return (NULL);
+				if (n > max_size())
+					throw std::bad_alloc();
+				void *mem = mmap(NULL, bytes(n), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+				if (mem == MAP_FAILED)
+					throw std::bad_alloc();
+				return (static_cast<pointer>(mem));
+			}
+
+			void deallocate(pointer p, size_type n)
+			{
+				if (p != NULL)
+					munmap(p, bytes(n));
+			}
+
+			// resizes the block of old_n elements at p to new_n, the content
+			// is kept but may live at a new address; the old pointer is dead
+			pointer reallocate(pointer p, size_type old_n, size_type new_n)
+			{
+				if (p == NULL)
+					return (allocate(new_n));
+				if (!new_n)
+				{
+					deallocate(p, old_n);
+					return (NULL);
+				}
+				if (new_n > max_size())
+					throw std::bad_alloc();
+				if (bytes(old_n) == bytes(new_n))
+					return (p);
+				void *mem = mremap(p, bytes(old_n), bytes(new_n), MREMAP_MAYMOVE);
+				if (mem == MAP_FAILED)
+					throw std::bad_alloc();
+				return (static_cast<pointer>(mem));
+			}
+
+			size_type max_size() const
+			{ return ((std::numeric_limits<size_type>::max() - page()) / sizeof(value_type)); }
+
+			void construct(pointer p, const_reference val)
+			{ ::new (static_cast<void *>(p)) value_type(val); }
+
+#if __cplusplus >= 201103L
+			template<class U, class... Args>
+			void construct(U *p, Args&&... args)
+			{ ::new (static_cast<void *>(p)) U(std::forward<Args>(args)...); }
+#endif
+
+			void destroy(pointer p)
+			{ p->~value_type(); }
+
+		private:
+			static size_type page()
+			{
+				static const size_type size = sysconf(_SC_PAGESIZE);
+				return (size);
+			}
+
+			static size_type bytes(size_type n)
+			{ return ((n * sizeof(value_type) + page() - 1) / page() * page()); }
+	};
+
+	template<class T, class U>
+	bool operator==(const mmap_allocator<T> &, const mmap_allocator<U> &)
+	{ return (true); }
+
+	template<class T, class U>
+	bool operator!=(const mmap_allocator<T> &, const mmap_allocator<U> &)
+	{ return (false); }
+
+	template<class T>
+	struct allocator_can_reallocate<mmap_allocator<T> > : true_type {};
+}
@@ -26,7 +26,7 @@ namespace ft
 		node		*parent;
 		node		*left;
 		node		*right;
-		int			color;
+		int			color; // owned by the tree's balancing policy (color, height...)
 		value_type	key_val;
 	};
 }
\ No newline at end of file
@@ -13,6 +13,9 @@
 #pragma once
 
 #include <iostream>
+#if __cplusplus >= 201103L
+# include <utility>
+#endif
 
 namespace ft
 {
@@ -38,6 +41,19 @@ namespace ft
 			:first(p.first), second(p.second)
 			{}
 
+#if __cplusplus >= 201103L
+			// defaulted: trivially copyable when T1 and T2 are, and nothrow
+			// movable when their moves are, so vectors of pairs memcpy or
+			// move them instead of copying
+			pair(const pair &p) = default;
+			pair(pair &&p) = default;
+			pair	&operator=(const pair &other) = default;
+			pair	&operator=(pair &&other) = default;
+#else
+			pair(const pair &p)
+			:first(p.first), second(p.second)
+			{}
+
 			pair	&operator=(const pair &other)
 			{
 				if (this != &other)
@@ -47,6 +63,7 @@ namespace ft
 				}
 				return (*this);
 			}
+#endif
 
 			operator pair<const T1, const T2>(void) const
 			{ return (pair<const T1, const T2>(this->first, this->second)); }
@@ -0,0 +1,341 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parallel.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+/*
+** PARALLEL ALGORITHMS
+** for_each, transform, reduce and transform_reduce on a thread_pool, C++11
+** only. Random access ranges are cut by index, a few chunks per thread so
+** stealing evens out uneven work. Maps are cut by subtree: the nodes of the
+** top levels of the tree are handled on the calling thread, the subtrees
+** below them are the tasks. Balancing keeps those subtrees within a factor
+** of two of each other, and they are walked through the nodes' links
+** rather than with iterators.
+** Reductions combine the pieces in order, so op only has to be
+** associative. An exception thrown by f or op is rethrown once every task
+** is done; the elements it did not reach may or may not have been visited.
+*/
+
+#if __cplusplus >= 201103L
+
+# include <cstddef>
+# include <vector>
+# include <functional>
+# include "thread_pool.hpp"
+# include "../containers/map.hpp"
+
+namespace ft
+{
+	/*
+	** SPLITTING
+	*/
+
+	// below this many elements a range is not worth a task
+	static const std::ptrdiff_t	parallel_grain = 1 << 12;
+
+	// bounds of the chunks of a range of n elements
+	inline std::vector<std::ptrdiff_t> split_range(std::ptrdiff_t n, const thread_pool &pool)
+	{
+		std::ptrdiff_t				chunks = static_cast<std::ptrdiff_t>(4 * (pool.size() + 1));
+		std::vector<std::ptrdiff_t>	bounds;
+
+		if (chunks > n / parallel_grain)
+			chunks = n / parallel_grain;
+		if (chunks < 1 || pool.size() == 0)
+			chunks = 1;
+		for (std::ptrdiff_t k = 0; k <= chunks; k++)
+			bounds.push_back(n * k / chunks);
+		return (bounds);
+	}
+
+	// a subtree, or a single node when whole is false
+	template<class Node>
+	struct tree_piece
+	{
+		Node	*node;
+		bool	whole;
+	};
+
+	template<class Node>
+	void split_tree(Node *cur, Node *sentinel, size_t depth, std::vector<tree_piece<Node> > &out)
+	{
+		if (cur == sentinel)
+			return ;
+		if (depth == 0)
+			return (out.push_back(tree_piece<Node>{cur, true}));
+		ft::split_tree<Node>(cur->left, sentinel, depth - 1, out);
+		out.push_back(tree_piece<Node>{cur, false});
+		ft::split_tree<Node>(cur->right, sentinel, depth - 1, out);
+	}
+
+	// the in-order pieces of a whole tree, given its begin() and end()
+	template<class TreeIt>
+	std::vector<tree_piece<typename TreeIt::node_type> >
+	split_tree(TreeIt begin, TreeIt end, size_t size, const thread_pool &pool)
+	{
+		typedef typename TreeIt::node_type	node_type;
+
+		std::vector<tree_piece<node_type> >	pieces;
+		node_type							*sentinel = end.base();
+		node_type							*root = begin.base();
+		size_t								depth = 0;
+
+		if (root == sentinel)
+			return (pieces);
+		while (root->parent != sentinel)
+			root = root->parent;
+		if (pool.size() > 0 && size >= static_cast<size_t>(parallel_grain))
+			for (size_t n = 1; n < 4 * (pool.size() + 1); n <<= 1)
+				depth++;
+		ft::split_tree<node_type>(root, sentinel, depth, pieces);
+		return (pieces);
+	}
+
+	template<class Node, class Function>
+	void walk_tree(Node *cur, Node *sentinel, Function &f)
+	{
+		while (cur != sentinel)
+		{
+			ft::walk_tree<Node>(cur->left, sentinel, f);
+			f(cur->key_val);
+			cur = cur->right;
+		}
+	}
+
+	template<class Node, class Function>
+	void walk_piece(const tree_piece<Node> &piece, Node *sentinel, Function &f)
+	{
+		if (piece.whole)
+			ft::walk_tree<Node>(piece.node, sentinel, f);
+		else
+			f(piece.node->key_val);
+	}
+
+	/*
+	** RANDOM ACCESS RANGES
+	*/
+
+	template<class RandomIt, class Function>
+	void parallel_for_each(RandomIt first, RandomIt last, Function f,
+			thread_pool &pool = thread_pool::global())
+	{
+		std::vector<std::ptrdiff_t>	bounds = ft::split_range(last - first, pool);
+		task_group					group(pool);
+
+		for (size_t k = 0; k + 1 < bounds.size(); k++)
+		{
+			RandomIt	begin = first + bounds[k];
+			RandomIt	end = first + bounds[k + 1];
+			group.run([=]() mutable {
+				for (RandomIt it = begin; it != end; ++it)
+					f(*it);
+			});
+		}
+		group.wait();
+	}
+
+	// out must be random access too
+	template<class RandomIt, class OutputIt, class UnaryOperation>
+	OutputIt parallel_transform(RandomIt first, RandomIt last, OutputIt out, UnaryOperation op,
+			thread_pool &pool = thread_pool::global())
+	{
+		std::vector<std::ptrdiff_t>	bounds = ft::split_range(last - first, pool);
+		task_group					group(pool);
+
+		for (size_t k = 0; k + 1 < bounds.size(); k++)
+		{
+			RandomIt	begin = first + bounds[k];
+			RandomIt	end = first + bounds[k + 1];
+			OutputIt	dst = out + bounds[k];
+			group.run([=]() mutable {
+				for (RandomIt it = begin; it != end; ++it, ++dst)
+					*dst = op(*it);
+			});
+		}
+		group.wait();
+		return (out + bounds.back());
+	}
+
+	// init reduce transform(first[0]) reduce transform(first[1])...
+	template<class RandomIt, class T, class BinaryOperation, class UnaryOperation>
+	T parallel_transform_reduce(RandomIt first, RandomIt last, T init, BinaryOperation reduce,
+			UnaryOperation transform, thread_pool &pool = thread_pool::global())
+	{
+		std::vector<std::ptrdiff_t>	bounds = ft::split_range(last - first, pool);
+		std::vector<T>				partial(bounds.size() - 1, init);
+		{
+			task_group group(pool);
+			for (size_t k = 0; k + 1 < bounds.size(); k++)
+			{
+				RandomIt	begin = first + bounds[k];
+				RandomIt	end = first + bounds[k + 1];
+				T			*result = &partial[k];
+				group.run([=]() mutable {
+					if (begin == end)
+						return ;
+					T acc = transform(*begin);
+					for (++begin; begin != end; ++begin)
+						acc = reduce(acc, transform(*begin));
+					*result = acc;
+				});
+			}
+			group.wait();
+		}
+		for (size_t k = 0; k + 1 < bounds.size(); k++)
+			if (bounds[k] != bounds[k + 1])
+				init = reduce(init, partial[k]);
+		return (init);
+	}
+
+	template<class RandomIt, class T, class BinaryOperation>
+	T parallel_reduce(RandomIt first, RandomIt last, T init, BinaryOperation op,
+			thread_pool &pool = thread_pool::global())
+	{
+		typedef typename ft::iterator_traits<RandomIt>::reference	reference;
+
+		return (ft::parallel_transform_reduce(first, last, init, op,
+			[](reference val) -> reference { return (val); }, pool));
+	}
+
+	template<class RandomIt, class T>
+	T parallel_reduce(RandomIt first, RandomIt last, T init)
+	{ return (ft::parallel_reduce(first, last, init, std::plus<T>())); }
+
+	/*
+	** MAPS
+	*/
+
+	template<class Key, class T, class Compare, class Alloc, class Balance, class Filter,
+		class Function>
+	void parallel_for_each(map<Key, T, Compare, Alloc, Balance, Filter> &m, Function f,
+			thread_pool &pool = thread_pool::global())
+	{
+		typedef typename map<Key, T, Compare, Alloc, Balance, Filter>::iterator	iterator;
+		typedef typename iterator::node_type									node_type;
+
+		std::vector<tree_piece<node_type> >	pieces = ft::split_tree(m.begin(), m.end(), m.size(), pool);
+		node_type							*sentinel = m.end().base();
+		task_group							group(pool);
+
+		for (size_t k = 0; k < pieces.size(); k++)
+		{
+			tree_piece<node_type> piece = pieces[k];
+			if (!piece.whole)
+				f(piece.node->key_val);
+			else
+				group.run([=]() mutable { ft::walk_tree<node_type>(piece.node, sentinel, f); });
+		}
+		group.wait();
+	}
+
+	// the map's elements in order, out must be random access
+	template<class Key, class T, class Compare, class Alloc, class Balance, class Filter,
+		class OutputIt, class UnaryOperation>
+	OutputIt parallel_transform(const map<Key, T, Compare, Alloc, Balance, Filter> &m, OutputIt out,
+			UnaryOperation op, thread_pool &pool = thread_pool::global())
+	{
+		typedef typename map<Key, T, Compare, Alloc, Balance, Filter>::const_iterator	iterator;
+		typedef typename iterator::node_type											node_type;
+		typedef typename iterator::value_type											value_type;
+
+		std::vector<tree_piece<node_type> >	pieces = ft::split_tree(m.begin(), m.end(), m.size(), pool);
+		node_type							*sentinel = m.end().base();
+		std::vector<std::ptrdiff_t>			offsets(pieces.size() + 1, 0);
+
+		// the sizes of the subtrees give where each piece starts writing
+		{
+			task_group group(pool);
+			for (size_t k = 0; k < pieces.size(); k++)
+			{
+				tree_piece<node_type>	piece = pieces[k];
+				std::ptrdiff_t			*count = &offsets[k + 1];
+				if (!piece.whole)
+					*count = 1;
+				else
+					group.run([=]() {
+						auto counter = [count](value_type &) { ++*count; };
+						ft::walk_tree<node_type>(piece.node, sentinel, counter);
+					});
+			}
+			group.wait();
+		}
+		for (size_t k = 0; k < pieces.size(); k++)
+			offsets[k + 1] += offsets[k];
+		task_group group(pool);
+		for (size_t k = 0; k < pieces.size(); k++)
+		{
+			tree_piece<node_type>	piece = pieces[k];
+			OutputIt				dst = out + offsets[k];
+			group.run([=]() mutable {
+				auto write = [&dst, &op](value_type &val) { *dst = op(val); ++dst; };
+				ft::walk_piece<node_type>(piece, sentinel, write);
+			});
+		}
+		group.wait();
+		return (out + offsets.back());
+	}
+
+	template<class Key, class T, class Compare, class Alloc, class Balance, class Filter,
+		class U, class BinaryOperation, class UnaryOperation>
+	U parallel_transform_reduce(const map<Key, T, Compare, Alloc, Balance, Filter> &m, U init,
+			BinaryOperation reduce, UnaryOperation transform, thread_pool &pool = thread_pool::global())
+	{
+		typedef typename map<Key, T, Compare, Alloc, Balance, Filter>::const_iterator	iterator;
+		typedef typename iterator::node_type											node_type;
+		typedef typename iterator::value_type											value_type;
+
+		std::vector<tree_piece<node_type> >	pieces = ft::split_tree(m.begin(), m.end(), m.size(), pool);
+		node_type							*sentinel = m.end().base();
+		std::vector<U>						partial(pieces.size(), init);
+		{
+			task_group group(pool);
+			for (size_t k = 0; k < pieces.size(); k++)
+			{
+				tree_piece<node_type>	piece = pieces[k];
+				U						*result = &partial[k];
+				auto					fold = [=]() mutable {
+					bool first = true;
+					auto step = [&](value_type &val) {
+						if (first)
+							*result = transform(val);
+						else
+							*result = reduce(*result, transform(val));
+						first = false;
+					};
+					ft::walk_piece<node_type>(piece, sentinel, step);
+				};
+				if (piece.whole)
+					group.run(fold);
+				else
+					fold();
+			}
+			group.wait();
+		}
+		for (size_t k = 0; k < pieces.size(); k++)
+			init = reduce(init, partial[k]);
+		return (init);
+	}
+
+	template<class Key, class T, class Compare, class Alloc, class Balance, class Filter,
+		class U, class BinaryOperation>
+	U parallel_reduce(const map<Key, T, Compare, Alloc, Balance, Filter> &m, U init,
+			BinaryOperation op, thread_pool &pool = thread_pool::global())
+	{
+		typedef typename map<Key, T, Compare, Alloc, Balance, Filter>::const_reference	reference;
+
+		return (ft::parallel_transform_reduce(m, init, op,
+			[](reference val) -> reference { return (val); }, pool));
+	}
+}
+
+#endif
@@ -0,0 +1,455 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   simd.hpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+#include <cstddef>
+#if defined(__x86_64__) || defined(__i386__)
+# define FT_SIMD_X86 1
+# include <immintrin.h>
+# define FT_TARGET(isa) __attribute__((target(isa)))
+#else
+# define FT_SIMD_X86 0
+#endif
+
+/*
+** SIMD KERNELS (FOR UTILS/ALGORITHM.HPP)
+** Search and reduction loops over arrays of int and float, in SSE4.1 and
+** AVX2 versions compiled with per-function target attributes: the rest of
+** the build stays on the baseline ISA, and the CPU is asked once (CPUID)
+** which version it can run. Every kernel returns what the plain loop
+** would, the scalar versions are the reference and handle the tails.
+*/
+
+namespace ft
+{
+	namespace simd
+	{
+		enum isa
+		{
+			SCALAR,
+			SSE41,
+			AVX2
+		};
+
+		inline isa detect()
+		{
+#if FT_SIMD_X86
+			__builtin_cpu_init();
+			if (__builtin_cpu_supports("avx2"))
+				return (AVX2);
+			if (__builtin_cpu_supports("sse4.1"))
+				return (SSE41);
+#endif
+			return (SCALAR);
+		}
+
+		inline isa &selected()
+		{
+			static isa level = detect();
+			return (level);
+		}
+
+		// the kernels in use
+		inline isa level()
+		{ return (selected()); }
+
+		// caps the kernels to level (never above what the CPU has), for
+		// benchmarks and tests; not to be called while other threads search
+		inline void set_level(isa l)
+		{ selected() = (l < detect() ? l : detect()); }
+
+		// below this many elements the dispatch is not worth it
+		static const size_t	min_length = 16;
+
+		/*
+		** SCALAR
+		*/
+
+		template<class T>
+		size_t find_scalar(const T *a, size_t n, T v)
+		{
+			size_t i = 0;
+			while (i < n && !(a[i] == v))
+				i++;
+			return (i);
+		}
+
+		template<class T>
+		size_t count_scalar(const T *a, size_t n, T v)
+		{
+			size_t c = 0;
+			for (size_t i = 0; i < n; i++)
+				c += (a[i] == v);
+			return (c);
+		}
+
+		// first smallest (Max: first largest) element, as min_element does
+		template<bool Max, class T>
+		size_t extremum_scalar(const T *a, size_t n)
+		{
+			size_t best = 0;
+			for (size_t i = 1; i < n; i++)
+			{
+				if (Max ? a[best] < a[i] : a[i] < a[best])
+					best = i;
+			}
+			return (best);
+		}
+
+		// wraps around on overflow instead of being undefined
+		inline int sum_scalar(const int *a, size_t n)
+		{
+			unsigned int s = 0;
+			for (size_t i = 0; i < n; i++)
+				s += static_cast<unsigned int>(a[i]);
+			return (static_cast<int>(s));
+		}
+
+#if FT_SIMD_X86
+		/*
+		** SSE4.1
+		*/
+
+		FT_TARGET("sse4.1")
+		inline int hreduce_epi32(__m128i v, bool max)
+		{
+			v = (max ? _mm_max_epi32(v, _mm_shuffle_epi32(v, 0x4E)) : _mm_min_epi32(v, _mm_shuffle_epi32(v, 0x4E)));
+			v = (max ? _mm_max_epi32(v, _mm_shuffle_epi32(v, 0xB1)) : _mm_min_epi32(v, _mm_shuffle_epi32(v, 0xB1)));
+			return (_mm_cvtsi128_si32(v));
+		}
+
+		FT_TARGET("sse4.1")
+		inline float hreduce_ps(__m128 v, bool max)
+		{
+			v = (max ? _mm_max_ps(v, _mm_movehl_ps(v, v)) : _mm_min_ps(v, _mm_movehl_ps(v, v)));
+			v = (max ? _mm_max_ps(v, _mm_shuffle_ps(v, v, 1)) : _mm_min_ps(v, _mm_shuffle_ps(v, v, 1)));
+			return (_mm_cvtss_f32(v));
+		}
+
+		FT_TARGET("sse4.1")
+		inline size_t find_sse41(const int *a, size_t n, int v)
+		{
+			const __m128i	needle = _mm_set1_epi32(v);
+			size_t			i = 0;
+
+			for (; i + 4 <= n; i += 4)
+			{
+				__m128i	x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+				int		mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(x, needle)));
+				if (mask)
+					return (i + __builtin_ctz(mask));
+			}
+			return (i + find_scalar(a + i, n - i, v));
+		}
+
+		FT_TARGET("sse4.1")
+		inline size_t find_sse41(const float *a, size_t n, float v)
+		{
+			const __m128	needle = _mm_set1_ps(v);
+			size_t			i = 0;
+
+			for (; i + 4 <= n; i += 4)
+			{
+				int mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(a + i), needle));
+				if (mask)
+					return (i + __builtin_ctz(mask));
+			}
+			return (i + find_scalar(a + i, n - i, v));
+		}
+
+		// per-lane counters are subtracted the all-ones compare results and
+		// emptied every block, before they could overflow
+		FT_TARGET("sse4.1")
+		inline size_t count_sse41(const int *a, size_t n, int v)
+		{
+			const __m128i	needle = _mm_set1_epi32(v);
+			size_t			c = 0;
+			size_t			i = 0;
+
+			while (i + 4 <= n)
+			{
+				__m128i	lanes = _mm_setzero_si128();
+				size_t	end = (n - i > (1u << 20) ? i + (1u << 20) : n);
+				for (; i + 4 <= end; i += 4)
+					lanes = _mm_sub_epi32(lanes, _mm_cmpeq_epi32(
+						_mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i)), needle));
+				lanes = _mm_add_epi32(lanes, _mm_shuffle_epi32(lanes, 0x4E));
+				lanes = _mm_add_epi32(lanes, _mm_shuffle_epi32(lanes, 0xB1));
+				c += static_cast<unsigned int>(_mm_cvtsi128_si32(lanes));
+			}
+			return (c + count_scalar(a + i, n - i, v));
+		}
+
+		FT_TARGET("sse4.1")
+		inline size_t count_sse41(const float *a, size_t n, float v)
+		{
+			const __m128	needle = _mm_set1_ps(v);
+			size_t			c = 0;
+			size_t			i = 0;
+
+			while (i + 4 <= n)
+			{
+				__m128i	lanes = _mm_setzero_si128();
+				size_t	end = (n - i > (1u << 20) ? i + (1u << 20) : n);
+				for (; i + 4 <= end; i += 4)
+					lanes = _mm_sub_epi32(lanes, _mm_castps_si128(_mm_cmpeq_ps(_mm_loadu_ps(a + i), needle)));
+				lanes = _mm_add_epi32(lanes, _mm_shuffle_epi32(lanes, 0x4E));
+				lanes = _mm_add_epi32(lanes, _mm_shuffle_epi32(lanes, 0xB1));
+				c += static_cast<unsigned int>(_mm_cvtsi128_si32(lanes));
+			}
+			return (c + count_scalar(a + i, n - i, v));
+		}
+
+		// the extreme value first, then where it is first found
+		template<bool Max>
+		FT_TARGET("sse4.1")
+		size_t extremum_sse41(const int *a, size_t n)
+		{
+			__m128i	acc = _mm_set1_epi32(a[0]);
+			size_t	i = 0;
+
+			for (; i + 4 <= n; i += 4)
+			{
+				__m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+				acc = (Max ? _mm_max_epi32(x, acc) : _mm_min_epi32(x, acc));
+			}
+			int best = hreduce_epi32(acc, Max);
+			for (; i < n; i++)
+				best = (Max ? (best < a[i] ? a[i] : best) : (a[i] < best ? a[i] : best));
+			return (find_sse41(a, n, best));
+		}
+
+		// minps / maxps return their second operand when one is NaN: with the
+		// accumulator second NaNs are skipped, like the < of the plain loop
+		template<bool Max>
+		FT_TARGET("sse4.1")
+		size_t extremum_sse41(const float *a, size_t n)
+		{
+			__m128	acc = _mm_set1_ps(a[0]);
+			size_t	i = 0;
+
+			for (; i + 4 <= n; i += 4)
+				acc = (Max ? _mm_max_ps(_mm_loadu_ps(a + i), acc) : _mm_min_ps(_mm_loadu_ps(a + i), acc));
+			float best = hreduce_ps(acc, Max);
+			for (; i < n; i++)
+				best = (Max ? (best < a[i] ? a[i] : best) : (a[i] < best ? a[i] : best));
+			return (find_sse41(a, n, best));
+		}
+
+		FT_TARGET("sse4.1")
+		inline int sum_sse41(const int *a, size_t n)
+		{
+			__m128i	acc = _mm_setzero_si128();
+			size_t	i = 0;
+
+			for (; i + 4 <= n; i += 4)
+				acc = _mm_add_epi32(acc, _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i)));
+			acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, 0x4E));
+			acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, 0xB1));
+			return (static_cast<int>(static_cast<unsigned int>(_mm_cvtsi128_si32(acc))
+				+ static_cast<unsigned int>(sum_scalar(a + i, n - i))));
+		}
+
+		/*
+		** AVX2
+		*/
+
+		FT_TARGET("avx2")
+		inline size_t find_avx2(const int *a, size_t n, int v)
+		{
+			const __m256i	needle = _mm256_set1_epi32(v);
+			size_t			i = 0;
+
+			for (; i + 8 <= n; i += 8)
+			{
+				__m256i	x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+				int		mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(x, needle)));
+				if (mask)
+					return (i + __builtin_ctz(mask));
+			}
+			return (i + find_scalar(a + i, n - i, v));
+		}
+
+		FT_TARGET("avx2")
+		inline size_t find_avx2(const float *a, size_t n, float v)
+		{
+			const __m256	needle = _mm256_set1_ps(v);
+			size_t			i = 0;
+
+			for (; i + 8 <= n; i += 8)
+			{
+				int mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(a + i), needle, _CMP_EQ_OQ));
+				if (mask)
+					return (i + __builtin_ctz(mask));
+			}
+			return (i + find_scalar(a + i, n - i, v));
+		}
+
+		FT_TARGET("avx2")
+		inline size_t count_avx2(const int *a, size_t n, int v)
+		{
+			const __m256i	needle = _mm256_set1_epi32(v);
+			size_t			c = 0;
+			size_t			i = 0;
+
+			while (i + 8 <= n)
+			{
+				__m256i	lanes = _mm256_setzero_si256();
+				size_t	end = (n - i > (1u << 20) ? i + (1u << 20) : n);
+				for (; i + 8 <= end; i += 8)
+					lanes = _mm256_sub_epi32(lanes, _mm256_cmpeq_epi32(
+						_mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i)), needle));
+				__m128i half = _mm_add_epi32(_mm256_castsi256_si128(lanes), _mm256_extracti128_si256(lanes, 1));
+				half = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0x4E));
+				half = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0xB1));
+				c += static_cast<unsigned int>(_mm_cvtsi128_si32(half));
+			}
+			return (c + count_scalar(a + i, n - i, v));
+		}
+
+		FT_TARGET("avx2")
+		inline size_t count_avx2(const float *a, size_t n, float v)
+		{
+			const __m256	needle = _mm256_set1_ps(v);
+			size_t			c = 0;
+			size_t			i = 0;
+
+			while (i + 8 <= n)
+			{
+				__m256i	lanes = _mm256_setzero_si256();
+				size_t	end = (n - i > (1u << 20) ? i + (1u << 20) : n);
+				for (; i + 8 <= end; i += 8)
+					lanes = _mm256_sub_epi32(lanes, _mm256_castps_si256(
+						_mm256_cmp_ps(_mm256_loadu_ps(a + i), needle, _CMP_EQ_OQ)));
+				__m128i half = _mm_add_epi32(_mm256_castsi256_si128(lanes), _mm256_extracti128_si256(lanes, 1));
+				half = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0x4E));
+				half = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0xB1));
+				c += static_cast<unsigned int>(_mm_cvtsi128_si32(half));
+			}
+			return (c + count_scalar(a + i, n - i, v));
+		}
+
+		template<bool Max>
+		FT_TARGET("avx2")
+		size_t extremum_avx2(const int *a, size_t n)
+		{
+			__m256i	acc = _mm256_set1_epi32(a[0]);
+			size_t	i = 0;
+
+			for (; i + 8 <= n; i += 8)
+			{
+				__m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+				acc = (Max ? _mm256_max_epi32(x, acc) : _mm256_min_epi32(x, acc));
+			}
+			__m128i	lo = _mm256_castsi256_si128(acc);
+			__m128i	hi = _mm256_extracti128_si256(acc, 1);
+			int		best = hreduce_epi32(Max ? _mm_max_epi32(lo, hi) : _mm_min_epi32(lo, hi), Max);
+			for (; i < n; i++)
+				best = (Max ? (best < a[i] ? a[i] : best) : (a[i] < best ? a[i] : best));
+			return (find_avx2(a, n, best));
+		}
+
+		template<bool Max>
+		FT_TARGET("avx2")
+		size_t extremum_avx2(const float *a, size_t n)
+		{
+			__m256	acc = _mm256_set1_ps(a[0]);
+			size_t	i = 0;
+
+			for (; i + 8 <= n; i += 8)
+				acc = (Max ? _mm256_max_ps(_mm256_loadu_ps(a + i), acc) : _mm256_min_ps(_mm256_loadu_ps(a + i), acc));
+			__m128	lo = _mm256_castps256_ps128(acc);
+			__m128	hi = _mm256_extractf128_ps(acc, 1);
+			float	best = hreduce_ps(Max ? _mm_max_ps(lo, hi) : _mm_min_ps(lo, hi), Max);
+			for (; i < n; i++)
+				best = (Max ? (best < a[i] ? a[i] : best) : (a[i] < best ? a[i] : best));
+			return (find_avx2(a, n, best));
+		}
+
+		// two accumulators to hide the latency of the adds
+		FT_TARGET("avx2")
+		inline int sum_avx2(const int *a, size_t n)
+		{
+			__m256i	acc0 = _mm256_setzero_si256();
+			__m256i	acc1 = _mm256_setzero_si256();
+			size_t	i = 0;
+
+			for (; i + 16 <= n; i += 16)
+			{
+				acc0 = _mm256_add_epi32(acc0, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i)));
+				acc1 = _mm256_add_epi32(acc1, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i + 8)));
+			}
+			acc0 = _mm256_add_epi32(acc0, acc1);
+			__m128i half = _mm_add_epi32(_mm256_castsi256_si128(acc0), _mm256_extracti128_si256(acc0, 1));
+			half = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0x4E));
+			half = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0xB1));
+			return (static_cast<int>(static_cast<unsigned int>(_mm_cvtsi128_si32(half))
+				+ static_cast<unsigned int>(sum_scalar(a + i, n - i))));
+		}
+#endif
+
+		/*
+		** DISPATCH
+		*/
+
+		// index of the first element equal to v, n if none
+		template<class T>
+		size_t find(const T *a, size_t n, T v)
+		{
+#if FT_SIMD_X86
+			if (n >= min_length && level() == AVX2)
+				return (find_avx2(a, n, v));
+			if (n >= min_length && level() == SSE41)
+				return (find_sse41(a, n, v));
+#endif
+			return (find_scalar(a, n, v));
+		}
+
+		template<class T>
+		size_t count(const T *a, size_t n, T v)
+		{
+#if FT_SIMD_X86
+			if (n >= min_length && level() == AVX2)
+				return (count_avx2(a, n, v));
+			if (n >= min_length && level() == SSE41)
+				return (count_sse41(a, n, v));
+#endif
+			return (count_scalar(a, n, v));
+		}
+
+		// index of the first smallest (Max: largest) element, 0 if n is 0;
+		// a NaN in front wins, like with the plain loop
+		template<bool Max, class T>
+		size_t extremum(const T *a, size_t n)
+		{
+#if FT_SIMD_X86
+			if (n >= min_length && a[0] == a[0] && level() == AVX2)
+				return (extremum_avx2<Max>(a, n));
+			if (n >= min_length && a[0] == a[0] && level() == SSE41)
+				return (extremum_sse41<Max>(a, n));
+#endif
+			return (extremum_scalar<Max>(a, n));
+		}
+
+		inline int sum(const int *a, size_t n)
+		{
+#if FT_SIMD_X86
+			if (n >= min_length && level() == AVX2)
+				return (sum_avx2(a, n));
+			if (n >= min_length && level() == SSE41)
+				return (sum_sse41(a, n));
+#endif
+			return (sum_scalar(a, n));
+		}
+	}
+}
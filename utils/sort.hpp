@@ -0,0 +1,667 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sort.hpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+#include <limits>
+#include <new>
+#include <memory>
+#include <cstring>
+#include <cstddef>
+#include <stdint.h>
+#include <functional>
+#include "algorithm.hpp"
+#include "memory.hpp"
+#include "type_traits.hpp"
+#include "../iterator/iterator.hpp"
+#include "thread_pool.hpp"
+
+/*
+** SORTING (RANDOM ACCESS ITERATORS)
+** sort is an introsort: quicksort on a median of three, heapsort once the
+** recursion gets deeper than 2 * log2(n), insertion sort for the small
+** partitions. stable_sort is a merge sort through a buffer of n / 2.
+** Sorting integers or floating point stored contiguously with the default
+** order goes to radix_sort instead (n more memory, O(n) time).
+** parallel_sort (C++11) sorts one chunk per worker, then merges the runs in
+** rounds, each merge split between the workers. The merges are stable, so
+** parallel_stable_sort only changes how the chunks are sorted.
+*/
+
+namespace ft
+{
+	/*
+	** INSERTION SORT / HEAPSORT
+	*/
+
+	template<class RandomIt, class Compare>
+	void insertion_sort(RandomIt first, RandomIt last, Compare comp)
+	{
+		typedef typename ft::iterator_traits<RandomIt>::value_type	value_type;
+
+		if (first == last)
+			return ;
+		for (RandomIt i = first + 1; i != last; ++i)
+		{
+			value_type	val(FT_MOVE(*i));
+			RandomIt	hole = i;
+			for (; hole != first && comp(val, *(hole - 1)); --hole)
+				*hole = FT_MOVE(*(hole - 1));
+			*hole = FT_MOVE(val);
+		}
+	}
+
+	template<class RandomIt, class Distance, class Compare>
+	void sift_down(RandomIt first, Distance root, Distance n, Compare comp)
+	{
+		typedef typename ft::iterator_traits<RandomIt>::value_type	value_type;
+
+		value_type	val(FT_MOVE(first[root]));
+		Distance	child;
+
+		while ((child = 2 * root + 1) < n)
+		{
+			if (child + 1 < n && comp(first[child], first[child + 1]))
+				child++;
+			if (!comp(val, first[child]))
+				break ;
+			first[root] = FT_MOVE(first[child]);
+			root = child;
+		}
+		first[root] = FT_MOVE(val);
+	}
+
+	template<class RandomIt, class Compare>
+	void heap_sort(RandomIt first, RandomIt last, Compare comp)
+	{
+		typedef typename ft::iterator_traits<RandomIt>::difference_type	difference_type;
+
+		difference_type n = last - first;
+		for (difference_type i = n / 2; i > 0; i--)
+			ft::sift_down(first, i - 1, n, comp);
+		for (difference_type end = n - 1; end > 0; end--)
+		{
+			std::swap(first[0], first[end]);
+			ft::sift_down(first, static_cast<difference_type>(0), end, comp);
+		}
+	}
+
+	/*
+	** INTROSORT
+	*/
+
+	static const std::ptrdiff_t	sort_threshold = 16;
+
+	// puts the median of a, b and c in result
+	template<class RandomIt, class Compare>
+	void move_median_to(RandomIt result, RandomIt a, RandomIt b, RandomIt c, Compare comp)
+	{
+		if (comp(*a, *b))
+		{
+			if (comp(*b, *c))
+				std::swap(*result, *b);
+			else if (comp(*a, *c))
+				std::swap(*result, *c);
+			else
+				std::swap(*result, *a);
+		}
+		else if (comp(*a, *c))
+			std::swap(*result, *a);
+		else if (comp(*b, *c))
+			std::swap(*result, *c);
+		else
+			std::swap(*result, *b);
+	}
+
+	// Hoare partition around *pivot, which sits before first; the median of
+	// three guarantees both scans stop inside the range
+	template<class RandomIt, class Compare>
+	RandomIt unguarded_partition(RandomIt first, RandomIt last, RandomIt pivot, Compare comp)
+	{
+		for (;;)
+		{
+			while (comp(*first, *pivot))
+				++first;
+			--last;
+			while (comp(*pivot, *last))
+				--last;
+			if (!(first < last))
+				return (first);
+			std::swap(*first, *last);
+			++first;
+		}
+	}
+
+	// leaves partitions of sort_threshold elements or less unsorted
+	template<class RandomIt, class Compare>
+	void introsort_loop(RandomIt first, RandomIt last, size_t depth, Compare comp)
+	{
+		while (last - first > sort_threshold)
+		{
+			if (depth == 0)
+				return (ft::heap_sort(first, last, comp));
+			depth--;
+			RandomIt mid = first + (last - first) / 2;
+			ft::move_median_to(first, first + 1, mid, last - 1, comp);
+			RandomIt cut = ft::unguarded_partition(first + 1, last, first, comp);
+			ft::introsort_loop(cut, last, depth, comp);
+			last = cut;
+		}
+	}
+
+	/*
+	** RADIX SORT
+	** LSD on bytes, over keys mapped to unsigned integers that sort in the
+	** same order: sign bit flipped for signed integers, all bits flipped for
+	** negative floating point and only the sign bit for positive ones. The
+	** byte histograms are all counted in one pass and the passes where all
+	** keys share the byte are skipped. Stable; -0.0 lands before 0.0 and
+	** NaNs at either end.
+	*/
+
+	template<size_t Size>
+	struct unsigned_of {};
+
+	template<>
+	struct unsigned_of<1> { typedef uint8_t type; };
+
+	template<>
+	struct unsigned_of<2> { typedef uint16_t type; };
+
+	template<>
+	struct unsigned_of<4> { typedef uint32_t type; };
+
+	template<>
+	struct unsigned_of<8> { typedef uint64_t type; };
+
+	template<class T>
+	struct is_radix_sortable : integral_constant<bool, (is_integral<T>::value
+		|| is_same<T, float>::value || is_same<T, double>::value)
+		&& (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)> {};
+
+	// the value type of an iterator that is not contiguous
+	template<>
+	struct is_radix_sortable<void> : false_type {};
+
+	template<class T>
+	struct radix_key
+	{
+		typedef typename unsigned_of<sizeof(T)>::type	type;
+
+		static type get(const T &val)
+		{
+			const type	sign = static_cast<type>(static_cast<type>(1) << (sizeof(T) * 8 - 1));
+			type		bits;
+
+			std::memcpy(&bits, &val, sizeof(T));
+			if (!std::numeric_limits<T>::is_integer)
+				return (static_cast<type>((bits & sign) ? ~bits : (bits | sign)));
+			if (std::numeric_limits<T>::is_signed)
+				return (static_cast<type>(bits ^ sign));
+			return (bits);
+		}
+	};
+
+	// sorts the n elements at data, buf has room for n more
+	template<class T>
+	void radix_sort(T *data, T *buf, size_t n)
+	{
+		typedef typename radix_key<T>::type	key_type;
+
+		size_t	counts[sizeof(T)][256];
+		T		*src = data;
+		T		*dst = buf;
+
+		if (n < 2)
+			return ;
+		std::memset(counts, 0, sizeof(counts));
+		for (size_t i = 0; i < n; i++)
+		{
+			key_type key = radix_key<T>::get(data[i]);
+			for (size_t d = 0; d < sizeof(T); d++)
+				counts[d][(key >> (d * 8)) & 0xFF]++;
+		}
+		for (size_t d = 0; d < sizeof(T); d++)
+		{
+			size_t *count = counts[d];
+			if (count[(radix_key<T>::get(src[0]) >> (d * 8)) & 0xFF] == n)
+				continue ;
+			size_t offset = 0;
+			for (size_t b = 0; b < 256; b++)
+			{
+				size_t c = count[b];
+				count[b] = offset;
+				offset += c;
+			}
+			for (size_t i = 0; i < n; i++)
+				dst[count[(radix_key<T>::get(src[i]) >> (d * 8)) & 0xFF]++] = src[i];
+			std::swap(src, dst);
+		}
+		if (src != data)
+			std::memcpy(static_cast<void *>(data), static_cast<const void *>(src), n * sizeof(T));
+	}
+
+	template<class RandomIt>
+	void radix_sort(RandomIt first, RandomIt last)
+	{
+		typedef typename contiguous_value<RandomIt>::type	value_type;
+
+		std::allocator<value_type>	alloc;
+		size_t						n = last - first;
+
+		if (n < 2)
+			return ;
+		value_type *buf = alloc.allocate(n);
+		ft::radix_sort(const_cast<value_type *>(ft::to_address(first)), buf, n);
+		alloc.deallocate(buf, n);
+	}
+
+	// contiguous radix sortable elements in their natural order
+	template<class RandomIt, class Compare>
+	struct use_radix_sort : integral_constant<bool, is_contiguous_iterator<RandomIt>::value
+		&& is_radix_sortable<typename contiguous_value<RandomIt>::type>::value
+		&& is_same<Compare, std::less<typename contiguous_value<RandomIt>::type> >::value> {};
+
+	// below this the comparison sort wins
+	static const std::ptrdiff_t	radix_threshold = 256;
+
+	/*
+	** SORT
+	*/
+
+	namespace detail
+	{
+		template<class RandomIt, class Compare>
+		void sort(RandomIt first, RandomIt last, Compare comp, ft::false_type)
+		{
+			size_t depth = 0;
+
+			for (std::ptrdiff_t n = last - first; n > 1; n >>= 1)
+				depth += 2;
+			ft::introsort_loop(first, last, depth, comp);
+			ft::insertion_sort(first, last, comp);
+		}
+
+		template<class RandomIt, class Compare>
+		void sort(RandomIt first, RandomIt last, Compare comp, ft::true_type)
+		{
+			if (last - first < radix_threshold)
+				return (ft::detail::sort(first, last, comp, ft::false_type()));
+			ft::radix_sort(first, last);
+		}
+	}
+
+	template<class RandomIt, class Compare>
+	void sort(RandomIt first, RandomIt last, Compare comp)
+	{ ft::detail::sort(first, last, comp, typename use_radix_sort<RandomIt, Compare>::type()); }
+
+	template<class RandomIt>
+	void sort(RandomIt first, RandomIt last)
+	{
+		typedef typename ft::iterator_traits<RandomIt>::value_type	value_type;
+
+		ft::sort(first, last, std::less<typename remove_const<value_type>::type>());
+	}
+
+	/*
+	** STABLE SORT
+	*/
+
+	// raw storage for n elements of T, built in order the first time the
+	// merges write them, so T only has to be movable; destroyed with it
+	template<class T>
+	class sort_buffer
+	{
+		public:
+			explicit sort_buffer(size_t n)
+			: _data(_alloc.allocate(n ? n : 1)), _size(0), _capacity(n ? n : 1) {}
+
+			~sort_buffer()
+			{
+				ft::destroy_range(_data, _data + _size, _alloc);
+				_alloc.deallocate(_data, _capacity);
+			}
+
+			T *data()
+			{ return (_data); }
+
+			// moves val to slot i, which is built already or the next one
+			void put(size_t i, T &val)
+			{
+				if (i < _size)
+					_data[i] = FT_MOVE(val);
+				else
+				{
+					_alloc.construct(_data + i, FT_MOVE(val));
+					_size++;
+				}
+			}
+
+			// the first n slots were built through data()
+			void built(size_t n)
+			{ _size = n; }
+
+		private:
+			sort_buffer(const sort_buffer &);
+			sort_buffer &operator=(const sort_buffer &);
+
+			std::allocator<T>	_alloc;
+			T					*_data;
+			size_t				_size;
+			size_t				_capacity;
+	};
+
+	// merges [first, mid) and [mid, last) through buf, which holds at least
+	// mid - first elements; on ties the left run goes first
+	template<class RandomIt, class T, class Compare>
+	void merge_with_buffer(RandomIt first, RandomIt mid, RandomIt last, sort_buffer<T> &buf, Compare comp)
+	{
+		T	*left = buf.data();
+		T	*left_end = left;
+
+		for (RandomIt it = first; it != mid; ++it, ++left_end)
+			buf.put(left_end - left, *it);
+		while (left != left_end && mid != last)
+		{
+			if (comp(*mid, *left))
+				*first++ = FT_MOVE(*mid++);
+			else
+				*first++ = FT_MOVE(*left++);
+		}
+		while (left != left_end)
+			*first++ = FT_MOVE(*left++);
+	}
+
+	template<class RandomIt, class T, class Compare>
+	void merge_sort(RandomIt first, RandomIt last, sort_buffer<T> &buf, Compare comp)
+	{
+		if (last - first <= sort_threshold)
+			return (ft::insertion_sort(first, last, comp));
+		RandomIt mid = first + (last - first) / 2;
+		ft::merge_sort(first, mid, buf, comp);
+		ft::merge_sort(mid, last, buf, comp);
+		if (comp(*mid, *(mid - 1)))
+			ft::merge_with_buffer(first, mid, last, buf, comp);
+	}
+
+	template<class RandomIt, class Compare>
+	void stable_sort(RandomIt first, RandomIt last, Compare comp)
+	{
+		typedef typename ft::iterator_traits<RandomIt>::value_type	value_type;
+
+		if (last - first <= sort_threshold)
+			return (ft::insertion_sort(first, last, comp));
+		sort_buffer<typename remove_const<value_type>::type> buf((last - first) / 2);
+		ft::merge_sort(first, last, buf, comp);
+	}
+
+	template<class RandomIt>
+	void stable_sort(RandomIt first, RandomIt last)
+	{
+		typedef typename ft::iterator_traits<RandomIt>::value_type	value_type;
+
+		ft::stable_sort(first, last, std::less<typename remove_const<value_type>::type>());
+	}
+
+#if __cplusplus >= 201103L
+	/*
+	** PARALLEL SORT
+	*/
+
+	// how many of the d first merged elements come from a, merging a (la
+	// elements) and b (lb elements) with a first on ties
+	template<class It1, class It2, class Compare>
+	std::ptrdiff_t merge_split(It1 a, std::ptrdiff_t la, It2 b, std::ptrdiff_t lb,
+			std::ptrdiff_t d, Compare comp)
+	{
+		std::ptrdiff_t lo = (d > lb ? d - lb : 0);
+		std::ptrdiff_t hi = (d < la ? d : la);
+
+		while (lo < hi)
+		{
+			std::ptrdiff_t i = lo + (hi - lo) / 2;
+			if (comp(b[d - i - 1], a[i]))
+				hi = i;
+			else
+				lo = i + 1;
+		}
+		return (lo);
+	}
+
+	// out is left past the last element written
+	template<class In1, class In2, class Out, class Compare>
+	void merge_move(In1 a, In1 a_end, In2 b, In2 b_end, Out &out, Compare comp)
+	{
+		while (a != a_end && b != b_end)
+		{
+			if (comp(*b, *a))
+				*out++ = std::move(*b++);
+			else
+				*out++ = std::move(*a++);
+		}
+		while (a != a_end)
+			*out++ = std::move(*a++);
+		while (b != b_end)
+			*out++ = std::move(*b++);
+	}
+
+	// output iterator moving the elements into raw storage: the first merge
+	// round builds the buffer instead of assigning to it
+	template<class T>
+	class construct_output
+	{
+		public:
+			explicit construct_output(T *p) : _p(p) {}
+
+			construct_output &operator*()
+			{ return (*this); }
+
+			construct_output &operator++()
+			{
+				++_p;
+				return (*this);
+			}
+
+			construct_output operator++(int)
+			{
+				construct_output tmp(*this);
+				++_p;
+				return (tmp);
+			}
+
+			construct_output operator+(std::ptrdiff_t n) const
+			{ return (construct_output(_p + n)); }
+
+			construct_output &operator=(T &&val)
+			{
+				::new (static_cast<void *>(_p)) T(std::move(val));
+				return (*this);
+			}
+
+			T *base() const
+			{ return (_p); }
+
+		private:
+			T	*_p;
+	};
+
+	// undoes what a merge wrote to [first, last) if it built it
+	template<class It>
+	void unbuild(It, It) {}
+
+	template<class T>
+	void unbuild(construct_output<T> first, construct_output<T> last)
+	{
+		for (T *p = first.base(); p != last.base(); ++p)
+			p->~T();
+	}
+
+	// the elements d0 to d1 of merging the run at a (la elements) with the
+	// next one (lb elements), i0 to i1 of them coming from the first run
+	struct merge_piece
+	{
+		std::ptrdiff_t	a;
+		std::ptrdiff_t	la;
+		std::ptrdiff_t	lb;
+		std::ptrdiff_t	d0;
+		std::ptrdiff_t	d1;
+		std::ptrdiff_t	i0;
+		std::ptrdiff_t	i1;
+	};
+
+	// merges runs two by two from src to dst, bounds[k] being where run k
+	// starts; each merge is cut in pieces of about n / parts elements. The
+	// cuts are all searched before any piece moves elements out of src. If
+	// a piece throws, what the round built in dst is destroyed
+	template<class Src, class Dst, class Compare>
+	void merge_round(Src src, Dst dst, std::vector<std::ptrdiff_t> &bounds, std::ptrdiff_t parts,
+			Compare comp, thread_pool &pool)
+	{
+		std::ptrdiff_t				n = bounds.back();
+		std::vector<std::ptrdiff_t>	next(1, 0);
+		std::vector<merge_piece>	pieces;
+
+		for (size_t r = 0; r + 1 < bounds.size(); r += 2)
+		{
+			merge_piece	piece;
+			piece.a = bounds[r];
+			piece.la = bounds[r + 1] - piece.a;
+			piece.lb = (r + 2 < bounds.size() ? bounds[r + 2] - bounds[r + 1] : 0);
+			std::ptrdiff_t count = (piece.la + piece.lb) * parts / n + 1;
+
+			for (std::ptrdiff_t p = 0; p < count; p++)
+			{
+				Src x = src + piece.a;
+				piece.d0 = (piece.la + piece.lb) * p / count;
+				piece.d1 = (piece.la + piece.lb) * (p + 1) / count;
+				piece.i0 = ft::merge_split(x, piece.la, x + piece.la, piece.lb, piece.d0, comp);
+				piece.i1 = ft::merge_split(x, piece.la, x + piece.la, piece.lb, piece.d1, comp);
+				pieces.push_back(piece);
+			}
+			next.push_back(piece.a + piece.la + piece.lb);
+		}
+		std::vector<char>	done(pieces.size(), 0);
+		task_group			group(pool);
+		for (size_t k = 0; k < pieces.size(); k++)
+		{
+			merge_piece	p = pieces[k];
+			char		*flag = &done[k];
+			group.run([=]() {
+				Src	x = src + p.a;
+				Dst	out = dst + (p.a + p.d0);
+				try
+				{
+					ft::merge_move(x + p.i0, x + p.i1, x + p.la + (p.d0 - p.i0),
+						x + p.la + (p.d1 - p.i1), out, comp);
+				}
+				catch (...)
+				{
+					ft::unbuild(dst + (p.a + p.d0), out);
+					throw ;
+				}
+				*flag = 1;
+			});
+		}
+		try
+		{
+			group.wait();
+		}
+		catch (...)
+		{
+			for (size_t k = 0; k < pieces.size(); k++)
+				if (done[k])
+					ft::unbuild(dst + (pieces[k].a + pieces[k].d0), dst + (pieces[k].a + pieces[k].d1));
+			throw ;
+		}
+		bounds.swap(next);
+	}
+
+	template<class RandomIt, class Compare>
+	void parallel_merge_sort(RandomIt first, RandomIt last, Compare comp, thread_pool &pool, bool stable)
+	{
+		typedef typename remove_const<typename ft::iterator_traits<RandomIt>::value_type>::type	value_type;
+
+		std::ptrdiff_t	n = last - first;
+		std::ptrdiff_t	parts = static_cast<std::ptrdiff_t>(pool.size());
+
+		if (parts < 2 || n < (1 << 16))
+			return (stable ? ft::stable_sort(first, last, comp) : ft::sort(first, last, comp));
+		std::vector<std::ptrdiff_t> bounds;
+		{
+			task_group group(pool);
+			for (std::ptrdiff_t k = 0; k <= parts; k++)
+				bounds.push_back(n * k / parts);
+			for (std::ptrdiff_t k = 0; k < parts; k++)
+			{
+				RandomIt	begin = first + bounds[k];
+				RandomIt	end = first + bounds[k + 1];
+				group.run([=]() {
+					if (stable)
+						ft::stable_sort(begin, end, comp);
+					else
+						ft::sort(begin, end, comp);
+				});
+			}
+			group.wait();
+		}
+		sort_buffer<value_type>	buf(n);
+		bool					in_buffer = true;
+		ft::merge_round(first, construct_output<value_type>(buf.data()), bounds, parts, comp, pool);
+		buf.built(n);
+		while (bounds.size() > 2)
+		{
+			if (in_buffer)
+				ft::merge_round(buf.data(), first, bounds, parts, comp, pool);
+			else
+				ft::merge_round(first, buf.data(), bounds, parts, comp, pool);
+			in_buffer = !in_buffer;
+		}
+		if (in_buffer)
+		{
+			task_group	group(pool);
+			value_type	*data = buf.data();
+			for (std::ptrdiff_t k = 0; k < parts; k++)
+			{
+				std::ptrdiff_t begin = n * k / parts;
+				std::ptrdiff_t end = n * (k + 1) / parts;
+				group.run([=]() { std::move(data + begin, data + end, first + begin); });
+			}
+			group.wait();
+		}
+	}
+
+	template<class RandomIt, class Compare>
+	void parallel_sort(RandomIt first, RandomIt last, Compare comp, thread_pool &pool)
+	{ ft::parallel_merge_sort(first, last, comp, pool, false); }
+
+	template<class RandomIt, class Compare>
+	void parallel_sort(RandomIt first, RandomIt last, Compare comp)
+	{ ft::parallel_sort(first, last, comp, thread_pool::global()); }
+
+	template<class RandomIt>
+	void parallel_sort(RandomIt first, RandomIt last)
+	{
+		typedef typename ft::iterator_traits<RandomIt>::value_type	value_type;
+
+		ft::parallel_sort(first, last, std::less<typename remove_const<value_type>::type>());
+	}
+
+	// equal elements keep their order
+	template<class RandomIt, class Compare>
+	void parallel_stable_sort(RandomIt first, RandomIt last, Compare comp, thread_pool &pool)
+	{ ft::parallel_merge_sort(first, last, comp, pool, true); }
+
+	template<class RandomIt, class Compare>
+	void parallel_stable_sort(RandomIt first, RandomIt last, Compare comp)
+	{ ft::parallel_stable_sort(first, last, comp, thread_pool::global()); }
+#endif
+}
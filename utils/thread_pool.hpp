@@ -0,0 +1,257 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   thread_pool.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: jabenjam <jabenjam@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:00:00 by jabenjam          #+#    #+#             */
+/*   Updated: 2026/10/19 10:00:00 by jabenjam         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#pragma once
+
+/*
+** THREAD POOL
+** A fixed set of workers running queued tasks, C++11 only (link with
+** -pthread). Each worker owns a deque: tasks it submits go to its back and
+** it takes them back from there (newest first, still in cache), idle
+** workers steal from the front of the others' deques (oldest first, the
+** biggest pieces of a recursive split). Tasks submitted from outside the
+** pool go to a shared deque, the last one.
+** Work is handed out through a task_group: run() queues a task, wait()
+** returns once all of the group's tasks are done and helps running queued
+** tasks in the meantime, so groups can be waited for from inside a task.
+** The first exception a task throws is rethrown by wait().
+*/
+
+#if __cplusplus >= 201103L
+
+# include <cstddef>
+# include <deque>
+# include <vector>
+# include <memory>
+# include <atomic>
+# include <mutex>
+# include <thread>
+# include <exception>
+# include <functional>
+# include <condition_variable>
+
+namespace ft
+{
+	class thread_pool
+	{
+		public:
+			typedef std::function<void()>	task_type;
+
+			// threads workers, the hardware's concurrency by default; with 0
+			// tasks only run in task_group::wait
+			explicit thread_pool(size_t threads = hardware_threads())
+			: _queued(0), _stop(false)
+			{
+				for (size_t i = 0; i <= threads; i++)
+					_queues.push_back(std::unique_ptr<queue>(new queue));
+				_workers.reserve(threads);
+				for (size_t i = 0; i < threads; i++)
+					_workers.push_back(std::thread(&thread_pool::work, this, i));
+			}
+
+			// lets the workers finish every queued task, then joins them
+			~thread_pool()
+			{
+				{
+					std::lock_guard<std::mutex> lock(_mutex);
+					_stop = true;
+				}
+				_ready.notify_all();
+				for (size_t i = 0; i < _workers.size(); i++)
+					_workers[i].join();
+			}
+
+			thread_pool(const thread_pool &) = delete;
+			thread_pool &operator=(const thread_pool &) = delete;
+
+			size_t size() const
+			{ return (_workers.size()); }
+
+			void submit(task_type task)
+			{
+				queue &q = *_queues[this->self()];
+				_queued++;
+				{
+					std::lock_guard<std::mutex> lock(q.mutex);
+					q.tasks.push_back(std::move(task));
+				}
+				// a worker going to sleep checks _queued under _mutex
+				{ std::lock_guard<std::mutex> lock(_mutex); }
+				_ready.notify_one();
+			}
+
+			// runs one queued task on the calling thread, false if none: its
+			// own newest task first, then the oldest of the others. Outsiders
+			// take from the shared deque newest first too, or a wait nested in
+			// a task would run unrelated tasks first and grow the stack with
+			// the number of tasks rather than with the nesting depth
+			bool run_one()
+			{
+				task_type	task;
+				size_t		self = this->self();
+
+				if (_queued.load() == 0)
+					return (false);
+				for (size_t i = 0; i < _queues.size(); i++)
+				{
+					size_t victim = (self + i) % _queues.size();
+					if (this->take(*_queues[victim], task, i == 0))
+					{
+						_queued--;
+						task();
+						return (true);
+					}
+				}
+				return (false);
+			}
+
+			static size_t hardware_threads()
+			{
+				size_t n = std::thread::hardware_concurrency();
+				return (n ? n : 1);
+			}
+
+			// shared by the parallel algorithms when none is given
+			static thread_pool &global()
+			{
+				static thread_pool pool;
+				return (pool);
+			}
+
+		private:
+			struct queue
+			{
+				std::mutex				mutex;
+				std::deque<task_type>	tasks;
+			};
+
+			// which worker of which pool the calling thread is
+			struct identity
+			{
+				const thread_pool	*pool;
+				size_t				index;
+			};
+
+			static identity &current()
+			{
+				static thread_local identity id = { nullptr, 0 };
+				return (id);
+			}
+
+			// the calling thread's deque, the shared one for outsiders
+			size_t self() const
+			{
+				const identity &id = current();
+				return (id.pool == this ? id.index : _workers.size());
+			}
+
+			bool take(queue &q, task_type &task, bool own)
+			{
+				std::lock_guard<std::mutex> lock(q.mutex);
+				if (q.tasks.empty())
+					return (false);
+				if (own)
+				{
+					task = std::move(q.tasks.back());
+					q.tasks.pop_back();
+				}
+				else
+				{
+					task = std::move(q.tasks.front());
+					q.tasks.pop_front();
+				}
+				return (true);
+			}
+
+			void work(size_t index)
+			{
+				identity &id = current();
+				id.pool = this;
+				id.index = index;
+				for (;;)
+				{
+					if (this->run_one())
+						continue ;
+					std::unique_lock<std::mutex> lock(_mutex);
+					_ready.wait(lock, [this] { return (_stop || _queued.load() != 0); });
+					if (_stop && _queued.load() == 0)
+						return ;
+				}
+			}
+
+			std::vector<std::thread>				_workers;
+			std::vector<std::unique_ptr<queue> >	_queues;
+			std::atomic<size_t>						_queued;
+			std::mutex								_mutex;
+			std::condition_variable					_ready;
+			bool									_stop;
+	};
+
+	class task_group
+	{
+		public:
+			explicit task_group(thread_pool &pool)
+			: _pool(pool), _pending(0)
+			{}
+
+			~task_group()
+			{
+				try { wait(); }
+				catch (...) {}
+			}
+
+			task_group(const task_group &) = delete;
+			task_group &operator=(const task_group &) = delete;
+
+			template<class F>
+			void run(F f)
+			{
+				_pending++;
+				_pool.submit([this, f]() mutable {
+					try { f(); }
+					catch (...) { this->fail(std::current_exception()); }
+					_pending--; // last touch: wait() may return right after
+				});
+			}
+
+			void wait()
+			{
+				while (_pending.load() != 0)
+				{
+					if (!_pool.run_one())
+						std::this_thread::yield();
+				}
+				std::lock_guard<std::mutex> lock(_mutex);
+				if (_error)
+				{
+					std::exception_ptr error = _error;
+					_error = nullptr;
+					std::rethrow_exception(error);
+				}
+			}
+
+		private:
+			void fail(std::exception_ptr error)
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				if (!_error)
+					_error = error;
+			}
+
+			thread_pool			&_pool;
+			std::atomic<size_t>	_pending;
+			std::mutex			_mutex;
+			std::exception_ptr	_error;
+	};
+}
+
+#endif
@@ -12,8 +12,35 @@
 
 #pragma once
 
+#include <cstddef>
+
+// clang deprecates __has_trivial_destructor, GCC before 14 lacks the
+// replacement
+#if defined(__has_builtin)
+# if __has_builtin(__is_trivially_destructible)
+#  define FT_IS_TRIVIALLY_DESTRUCTIBLE(T)	__is_trivially_destructible(T)
+# endif
+#endif
+#ifndef FT_IS_TRIVIALLY_DESTRUCTIBLE
+# define FT_IS_TRIVIALLY_DESTRUCTIBLE(T)	__has_trivial_destructor(T)
+#endif
+
 namespace ft
 {
+	template<class T, T v>
+	struct integral_constant
+	{
+		static const T value = v;
+		typedef T value_type;
+		typedef integral_constant type;
+	};
+
+	template<class T, T v>
+	const T integral_constant<T, v>::value;
+
+	typedef integral_constant<bool, true>	true_type;
+	typedef integral_constant<bool, false>	false_type;
+
 	template<bool B, class T = void>
 	struct enable_if {};
 
@@ -43,4 +70,73 @@ namespace ft
 
 	template<>
 	struct is_integral<long long> { static const bool value = true; };
+
+	template<>
+	struct is_integral<signed char> { static const bool value = true; };
+
+	template<>
+	struct is_integral<unsigned char> { static const bool value = true; };
+
+	template<>
+	struct is_integral<unsigned short> { static const bool value = true; };
+
+	template<>
+	struct is_integral<unsigned int> { static const bool value = true; };
+
+	template<>
+	struct is_integral<unsigned long> { static const bool value = true; };
+
+	template<>
+	struct is_integral<unsigned long long> { static const bool value = true; };
+
+	template<class T, class U>
+	struct is_same : false_type {};
+
+	template<class T>
+	struct is_same<T, T> : true_type {};
+
+	template<class T>
+	struct remove_const { typedef T type; };
+
+	template<class T>
+	struct remove_const<const T> { typedef T type; };
+
+	/*
+	** TRIVIAL COPY AND RELOCATION
+	** Trivially copyable types can be copied with memcpy. Trivially
+	** relocatable ones can be moved to a new address with memcpy, the old
+	** copy being dropped without running its destructor: specialize it for
+	** types that own resources but hold no pointer to themselves.
+	*/
+
+	template<class T>
+	struct is_trivially_copyable : integral_constant<bool, __is_trivially_copyable(T)> {};
+
+	template<class T>
+	struct is_trivially_default_constructible : integral_constant<bool, __is_trivially_constructible(T)> {};
+
+	template<class T>
+	struct is_trivially_destructible : integral_constant<bool, FT_IS_TRIVIALLY_DESTRUCTIBLE(T)> {};
+
+	template<class T>
+	struct is_trivially_relocatable : integral_constant<bool, is_trivially_copyable<T>::value> {};
+
+	/*
+	** ALIGNMENT
+	** The padding the compiler puts before a T following a char is its
+	** alignment requirement.
+	*/
+
+	template<class T>
+	struct alignment_of
+	{
+		private:
+			struct probe { char c; T t; };
+
+		public:
+			static const std::size_t value = sizeof(probe) - sizeof(T);
+	};
+
+	template<class T>
+	const std::size_t alignment_of<T>::value;
 }
\ No newline at end of file